@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <random>
+#include "model/game-components/MovableElementStore.h"
+#include "model/utils/CollisionUtils.h"
+
+namespace
+{
+
+const float PLAYER_X = 450;
+const float PLAYER_Y = 480;
+const float PLAYER_SIZE = 30;
+
+/**
+ * Fills a store with randomly placed elements and a player
+ *
+ * @param store the store to fill
+ * @param count the number of elements
+ * @return the player index
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::size_t fillStore(MovableElementStore& store, std::size_t count)
+{
+    std::default_random_engine generator;
+    std::uniform_real_distribution<float> positionX(0, 900);
+    std::uniform_real_distribution<float> positionY(380, 480);
+
+    for (std::size_t i = 0; i < count; i++) {
+        store.create(positionX(generator), positionY(generator), 25, 25, -1, COIN);
+    }
+
+    ElementHandle player = store.create(PLAYER_X, PLAYER_Y, PLAYER_SIZE, PLAYER_SIZE, 0, PLAYER);
+    return store.getIndex(player);
+}
+
+/**
+ * Former path: elements are tested one by one against the player
+ * @note Colliding flags are reset before each iteration, so that every element is tested;
+ * only the tests are timed
+ */
+void BM_PairwiseCollide(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    MovableElementStore initialStore(count + 1);
+    const std::size_t playerIndex = fillStore(initialStore, count);
+    MovableElementStore store(initialStore);
+
+    for (auto _ : state) {
+        store = initialStore;
+
+        auto start = std::chrono::steady_clock::now();
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < count; i++) {
+            hits += store.collide(i, playerIndex);
+        }
+        benchmark::DoNotOptimize(hits);
+        auto end = std::chrono::steady_clock::now();
+
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Batch test without SIMD instructions
+ */
+void BM_BatchScalar(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    MovableElementStore store(count + 1);
+    fillStore(store, count);
+
+    BoundingBoxBatch batch;
+    std::vector<std::uint32_t> hitMask;
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 0; i < count; i++) {
+        indexes.push_back(i);
+    }
+    store.fillBoundingBoxes(indexes, batch);
+
+    for (auto _ : state) {
+        CollisionUtils::findOverlapsScalar(PLAYER_X, PLAYER_Y - PLAYER_SIZE, PLAYER_X + PLAYER_SIZE, PLAYER_Y,
+                                           batch, hitMask);
+        benchmark::DoNotOptimize(hitMask.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Batch test with the SIMD kernel selected for the running CPU
+ */
+void BM_BatchSIMD(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    MovableElementStore store(count + 1);
+    fillStore(store, count);
+
+    BoundingBoxBatch batch;
+    std::vector<std::uint32_t> hitMask;
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 0; i < count; i++) {
+        indexes.push_back(i);
+    }
+    store.fillBoundingBoxes(indexes, batch);
+
+    for (auto _ : state) {
+        CollisionUtils::findOverlaps(PLAYER_X, PLAYER_Y - PLAYER_SIZE, PLAYER_X + PLAYER_SIZE, PLAYER_Y,
+                                     batch, hitMask);
+        benchmark::DoNotOptimize(hitMask.data());
+    }
+
+    state.SetLabel(CollisionUtils::getKernelName());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * GameModel path: boxes are gathered from the store then tested with the SIMD kernel
+ */
+void BM_GatherAndBatchSIMD(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    MovableElementStore store(count + 1);
+    fillStore(store, count);
+
+    BoundingBoxBatch batch;
+    std::vector<std::uint32_t> hitMask;
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 0; i < count; i++) {
+        indexes.push_back(i);
+    }
+
+    for (auto _ : state) {
+        store.fillBoundingBoxes(indexes, batch);
+
+        CollisionUtils::findOverlaps(PLAYER_X, PLAYER_Y - PLAYER_SIZE, PLAYER_X + PLAYER_SIZE, PLAYER_Y,
+                                     batch, hitMask);
+        benchmark::DoNotOptimize(hitMask.data());
+    }
+
+    state.SetLabel(CollisionUtils::getKernelName());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_PairwiseCollide)->RangeMultiplier(4)->Range(4, 1024)->UseManualTime();
+BENCHMARK(BM_BatchScalar)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_BatchSIMD)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_GatherAndBatchSIMD)->RangeMultiplier(4)->Range(4, 1024);
+
+}
+
+BENCHMARK_MAIN();
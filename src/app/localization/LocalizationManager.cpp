@@ -1,16 +1,24 @@
+#include <functional>
 #include "LocalizationManager.h"
+#include "libs/Logger/Tracer.h"
+#include "app/model/utils/StringHash.h"
 
 using std::string;
 using Bokoblin::SimpleLogger::Logger;
-using Bokoblin::XMLUtils::XMLHelper;
+using Bokoblin::SimpleLogger::Tracer;
 namespace ViewResources = Bokoblin::BokoRunner::Resources::Model;
 
 //------------------------------------------------
 //          STATIC MEMBERS
 //------------------------------------------------
 
-bool LocalizationManager::m_isInit = false;
-AppCore* LocalizationManager::m_appCore = nullptr;
+thread_local bool LocalizationManager::m_isInit = false;
+thread_local AppCore* LocalizationManager::m_appCore = nullptr;
+thread_local const LocalizedStringCatalog* LocalizationManager::m_catalog = nullptr;
+thread_local const string* LocalizationManager::m_catalogLanguageFile = nullptr;
+std::mutex LocalizationManager::m_catalogsMutex;
+std::map<string, std::unique_ptr<LocalizationManager::CatalogEntry>> LocalizationManager::m_catalogs;
+std::thread LocalizationManager::m_preloadThread;
 
 //------------------------------------------------
 //          PUBLIC METHODS
@@ -46,18 +54,56 @@ void LocalizationManager::closeContext()
  * @details takes the necessary measures otherwise
  *
  * @author Arthur
- * @date 11/02/17
+ * @date 11/02/17 - 17/10/2026
  */
 void LocalizationManager::checkContext()
 {
     if (m_isInit && m_appCore != nullptr) {
-        Logger::printInfo("Localization context verified");
+        Logger::printDebug("Localization context verified");
     } else {
         Logger::printError("Localization context check failed, please init it first...");
         throw LocalizationException();
     }
 }
 
+/**
+ * @brief Loads the catalogs of all languages on a worker thread
+ * @details A catalog requested while it's being preloaded is waited for,
+ * the other ones staying available. waitForPreloading() must be called before exit.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LocalizationManager::preloadCatalogs()
+{
+    if (m_preloadThread.joinable()) {
+        return;
+    }
+
+    m_preloadThread = std::thread([]() {
+        if (Tracer::isCompiled()) {
+            Tracer::setThreadName("localization preloading");
+        }
+        TRACE_SCOPE("localization", "LocalizationManager::preloadCatalogs");
+        for (const string* filename : {&ViewResources::ENGLISH_STRINGS, &ViewResources::FRENCH_STRINGS,
+                                       &ViewResources::SPANISH_STRINGS}) {
+            getCatalog(*filename);
+        }
+    });
+}
+
+/**
+ * @brief Waits for the end of the catalogs preloading, if started
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LocalizationManager::waitForPreloading()
+{
+    if (m_preloadThread.joinable()) {
+        m_preloadThread.join();
+    }
+}
+
 /**
  * @brief Retrieves a localized string for a given label.
  * @details Allows abstraction of the internationalization storage system
@@ -66,26 +112,63 @@ void LocalizationManager::checkContext()
  * @return the localized string
  *
  * @author Arthur
- * @date 04/01/2017 - 02/05/2020
+ * @date 04/01/2017 - 17/10/2026
  */
 string LocalizationManager::fetchLocalizedString(const string& label)
 {
-    string result;
-    try {
-        LocalizationManager::checkContext();
+    TRACE_SCOPE("localization", "LocalizationManager::fetchLocalizedString");
+    LocalizedString result{};
 
-        string currentLocaleFile = getLanguageFile();
-        result = XMLHelper::loadLabeledString(currentLocaleFile, label);
-    } catch (const LocalizationException& e) {
-        Logger::printWarning(e.what() + string("Localization checking failure, applying default language"));
-        result = XMLHelper::loadLabeledString(ViewResources::ENGLISH_STRINGS, label);
+    if (!findLocalizedString(hash(label), result)) {
+        Logger::printWarning("No string was found for expression \"", label, '"');
+        return "<" + label + ">";
     }
+    return string(result.utf8, result.length);
+}
+
+/**
+ * @brief Retrieves a localized string for a given label id
+ * @details Ids of labels known at build time are StringIds constants,
+ * it avoids hashing the label at each call
+ *
+ * @param id the id of the label to describe the string
+ * @return the localized string
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+string LocalizationManager::fetchLocalizedStringById(StringId id)
+{
+    TRACE_SCOPE("localization", "LocalizationManager::fetchLocalizedStringById");
+    LocalizedString result{};
 
-    if (result == "<" + label + ">") {
-        Logger::printWarning("No string was found for expression \"" + label + "\"");
+    if (!findLocalizedString(id, result)) {
+        Logger::printWarning("No string was found for id ", id);
+        return "<" + std::to_string(id) + ">";
     }
+    return string(result.utf8, result.length);
+}
 
-    return result;
+/**
+ * @brief Retrieves a localized string for a given label, decoded to UTF-32
+ * @details It avoids decoding the string when building an sf::String
+ *
+ * @param label the label to describe the string
+ * @return the localized string
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+Utf32String LocalizationManager::fetchLocalizedUtf32String(const string& label)
+{
+    TRACE_SCOPE("localization", "LocalizationManager::fetchLocalizedUtf32String");
+    LocalizedString result{};
+
+    if (!findLocalizedString(hash(label), result)) {
+        Logger::printWarning("No string was found for expression \"", label, '"');
+        return LocalizedStringCatalog::decodeUtf8("<" + label + ">");
+    }
+    return LocalizedStringCatalog::decodeUtf8(result.utf8, result.length);
 }
 
 
@@ -99,7 +182,7 @@ string LocalizationManager::fetchLocalizedString(const string& label)
  * @return the adequate language file
  *
  * @author Arthur
- * @date 11/02/18 - 22/03/20
+ * @date 11/02/18 - 17/10/2026
  */
 const string& LocalizationManager::getLanguageFile()
 {
@@ -111,3 +194,85 @@ const string& LocalizationManager::getLanguageFile()
         return ViewResources::ENGLISH_STRINGS; //Default
     }
 }
+
+/**
+ * @brief Finds the string of an id in the current language catalog
+ * @details The catalog is only looked up again when the language changes,
+ * the default language being used without context
+ *
+ * @param id the id of the label to describe the string
+ * @param result the found string
+ * @return true if the label is defined
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LocalizationManager::findLocalizedString(StringId id, LocalizedString& result)
+{
+    try {
+        LocalizationManager::checkContext();
+
+        const string& currentLocaleFile = getLanguageFile();
+        if (&currentLocaleFile != m_catalogLanguageFile) {
+            m_catalog = &getCatalog(currentLocaleFile);
+            m_catalogLanguageFile = &currentLocaleFile;
+        }
+        return m_catalog->find(id, result);
+    } catch (const LocalizationException& e) {
+        Logger::printWarning(e.what(), "Localization checking failure, applying default language");
+        return getCatalog(ViewResources::ENGLISH_STRINGS).find(id, result);
+    }
+}
+
+/**
+ * @brief Retrieves the catalog of a language file, loaded on first use
+ * @details Catalogs are shared by all threads and kept until exit.
+ * Each catalog is loaded once, without blocking the use of other ones
+ *
+ * @param filename the language file
+ * @return the language catalog
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+const LocalizedStringCatalog& LocalizationManager::getCatalog(const string& filename)
+{
+    CatalogEntry* entry;
+    {
+        std::lock_guard<std::mutex> lock(m_catalogsMutex);
+        std::unique_ptr<CatalogEntry>& catalogEntry = m_catalogs[filename];
+        if (catalogEntry == nullptr) {
+            catalogEntry.reset(new CatalogEntry());
+        }
+        entry = catalogEntry.get();
+    }
+
+    std::call_once(entry->loadFlag, loadCatalog, std::ref(entry->catalog), std::cref(filename));
+    return entry->catalog;
+}
+
+/**
+ * @brief Loads the catalog of a language file
+ * @details The compiled catalog of the language is mapped if it exists,
+ * the language file being parsed otherwise
+ *
+ * @param catalog the catalog to load
+ * @param filename the language file
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LocalizationManager::loadCatalog(LocalizedStringCatalog& catalog, const string& filename)
+{
+    const string name = filename.substr(filename.find_last_of('/') + 1);
+    const string compiledFilename = ViewResources::Folder::STRING_CATALOGS
+            + name.substr(0, name.find_last_of('.')) + ViewResources::COMPILED_STRINGS_EXTENSION;
+
+    if (catalog.loadCompiled(compiledFilename)) {
+        Logger::printInfo("String catalog \"", compiledFilename, "\" mapped (", catalog.getSize(), " strings)");
+    } else if (catalog.load(filename)) {
+        Logger::printInfo("Language file \"", filename, "\" loaded (", catalog.getSize(), " strings)");
+    } else {
+        Logger::printError("Language file loading failed for \"", filename, '"');
+    }
+}
@@ -16,25 +16,34 @@ limitations under the License.
 #ifndef LOCALIZATION_MANAGER_H
 #define LOCALIZATION_MANAGER_H
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include "libs/Logger/Logger.h"
 #include "libs/XMLHelper/XMLHelper.h"
 #include "app/model/core/AppCore.h"
 #include "LocalizationException.h"
+#include "LocalizedStringCatalog.h"
 
 class AppCore;
 
-//TODO [2.0.x] Maybe store config as static document xml instead of loading file each time
-//      Especially useful for languages files accessed a dozen times
 //TODO [2.x.x] Dynamic language handling (adding a language file adds it to available languages if valid)
 
 /**
  * The LocalizationManager class manages the app localization. \n
  * The localization method is abstracted from app's point of view in order to easily change
  * localization system by only changing this file. \n
- * The current localization system uses an xml string file for each supported language.
+ * The current localization system uses a binary string catalog for each supported language,
+ * compiled at build time from its xml string file and mapped once, shared by all threads. \n
+ * Without compiled catalog, the xml string file is parsed instead. \n
+ * All languages can be preloaded on a worker thread, so that switching language
+ * only swaps the catalog bound to the calling thread. \n
+ * Labels known at build time should be fetched with their StringIds constant. \n
+ * The context is bound per thread, like the persistence one.
  *
  * @author Arthur
- * @date 11/02/18 - 13/01/19
+ * @date 11/02/18 - 17/10/2026
  */
 class LocalizationManager
 {
@@ -43,15 +52,34 @@ public:
     static void initContext(AppCore& appCore);
     static void closeContext();
     static void checkContext();
+    static void preloadCatalogs();
+    static void waitForPreloading();
     static std::string fetchLocalizedString(const std::string& label);
+    static std::string fetchLocalizedStringById(StringId id);
+    static Utf32String fetchLocalizedUtf32String(const std::string& label);
 
 private:
+    //=== TYPEDEFS
+    struct CatalogEntry
+    {
+        std::once_flag loadFlag;
+        LocalizedStringCatalog catalog;
+    };
+
     //=== ATTRIBUTES
-    static bool m_isInit;
-    static AppCore* m_appCore;
+    static thread_local bool m_isInit;
+    static thread_local AppCore* m_appCore;
+    static thread_local const LocalizedStringCatalog* m_catalog;
+    static thread_local const std::string* m_catalogLanguageFile;
+    static std::mutex m_catalogsMutex;
+    static std::map<std::string, std::unique_ptr<CatalogEntry>> m_catalogs;
+    static std::thread m_preloadThread;
 
     //=== METHODS
     static const std::string& getLanguageFile();
+    static bool findLocalizedString(StringId id, LocalizedString& result);
+    static const LocalizedStringCatalog& getCatalog(const std::string& filename);
+    static void loadCatalog(LocalizedStringCatalog& catalog, const std::string& filename);
 };
 
 #endif
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <sstream>
+#include "LocalizedStringCatalog.h"
+#include "libs/Logger/Logger.h"
+#include "libs/Logger/Tracer.h"
+#include "libs/XMLHelper/XMLHelper.h"
+
+using std::string;
+using Bokoblin::SimpleLogger::Logger;
+using Bokoblin::XMLUtils::XMLHelper;
+
+namespace
+{
+const std::uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+}
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs an empty catalog
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LocalizedStringCatalog::LocalizedStringCatalog() : m_view{0, nullptr, nullptr, nullptr}
+{}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+const string& LocalizedStringCatalog::getFilename() const { return m_filename; }
+std::size_t LocalizedStringCatalog::getSize() const { return m_view.count; }
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Loads all strings of a language file, replacing previous ones
+ * @details The strings are compiled in memory to the binary catalog format
+ *
+ * @param filename the language file name
+ * @return true if the file could be parsed and compiled, the catalog being empty otherwise
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LocalizedStringCatalog::load(const string& filename)
+{
+    TRACE_SCOPE("localization", "LocalizedStringCatalog::load");
+    StringCatalogFormat::Entries entries;
+    std::ostringstream stream;
+    string error;
+
+    clear();
+    m_filename = filename;
+
+    if (!readLanguageFile(filename, entries)) {
+        return false;
+    }
+
+    if (!StringCatalogFormat::write(stream, entries, error)) {
+        Logger::printError("Language file \"", filename, "\" can't be compiled: ", error);
+        return false;
+    }
+
+    m_content = stream.str();
+    if (!StringCatalogFormat::read(m_content.data(), m_content.size(), m_view)) {
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Loads a compiled catalog, replacing previous strings
+ * @details The file is mapped in memory and only its tables are checked
+ *
+ * @param filename the compiled catalog file name
+ * @return true if the file is a valid catalog, the catalog being empty otherwise
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LocalizedStringCatalog::loadCompiled(const string& filename)
+{
+    TRACE_SCOPE("localization", "LocalizedStringCatalog::loadCompiled");
+    clear();
+    m_filename = filename;
+
+    if (!m_file.open(filename) || !StringCatalogFormat::read(m_file.getData(), m_file.getSize(), m_view)) {
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Finds the string of an id
+ *
+ * @param id the id of the label to describe the string
+ * @param result the found string, valid while the catalog is loaded
+ * @return true if the label is defined
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LocalizedStringCatalog::find(StringId id, LocalizedString& result) const
+{
+    const std::uint32_t* end = m_view.ids + m_view.count;
+    const std::uint32_t* it = std::lower_bound(m_view.ids, end, id);
+
+    if (it == end || *it != id) {
+        return false;
+    }
+
+    const std::size_t index = static_cast<std::size_t>(it - m_view.ids);
+    result.utf8 = m_view.texts + m_view.offsets[index];
+    result.length = m_view.offsets[index + 1] - m_view.offsets[index] - 1;
+    return true;
+}
+
+/**
+ * @brief Reads the labels and values of a language file, in file order
+ *
+ * @param filename the language file name
+ * @param entries the read labels and values
+ * @return true if the file could be parsed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LocalizedStringCatalog::readLanguageFile(const string& filename, StringCatalogFormat::Entries& entries)
+{
+    Bokoblin::XMLUtils::MappedXMLDocument doc;
+
+    if (!XMLHelper::loadXMLFile(doc, filename)) {
+        return false;
+    }
+
+    for (pugi::xml_node item: doc.getDocument().child("resources").children("string")) {
+        entries.emplace_back(item.attribute("name").value(), item.attribute("value").value());
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decodes an UTF-8 string to UTF-32
+ * @details Each invalid or truncated sequence is decoded as one replacement character
+ *
+ * @param utf8 the UTF-8 characters
+ * @param length the number of UTF-8 characters
+ * @return the UTF-32 string
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+Utf32String LocalizedStringCatalog::decodeUtf8(const char* utf8, std::size_t length)
+{
+    Utf32String utf32;
+    utf32.reserve(length);
+    std::size_t i = 0;
+
+    while (i < length) {
+        const auto lead = static_cast<unsigned char>(utf8[i]);
+        const std::size_t sequenceLength = lead < 0x80 ? 1 : lead >> 5 == 0x6 ? 2 : lead >> 4 == 0xE ? 3 : lead >> 3 == 0x1E ? 4 : 0;
+        std::uint32_t codePoint = sequenceLength == 1 ? lead : lead & (0x7F >> sequenceLength);
+        std::size_t decodedLength = 1;
+
+        while (decodedLength < sequenceLength && i + decodedLength < length
+                && static_cast<unsigned char>(utf8[i + decodedLength]) >> 6 == 0x2) {
+            codePoint = (codePoint << 6) | (utf8[i + decodedLength] & 0x3F);
+            decodedLength++;
+        }
+
+        utf32.push_back(sequenceLength > 0 && decodedLength == sequenceLength ? codePoint : REPLACEMENT_CHARACTER);
+        i += decodedLength;
+    }
+
+    return utf32;
+}
+
+/**
+ * @brief Decodes an UTF-8 string to UTF-32
+ *
+ * @param utf8 the UTF-8 string
+ * @return the UTF-32 string
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+Utf32String LocalizedStringCatalog::decodeUtf8(const string& utf8)
+{
+    return decodeUtf8(utf8.data(), utf8.size());
+}
+
+/**
+ * @brief Removes all strings, unmapping the compiled catalog
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LocalizedStringCatalog::clear()
+{
+    m_view = StringCatalogView{0, nullptr, nullptr, nullptr};
+    m_file.close();
+    m_content.clear();
+}
@@ -0,0 +1,83 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef LOCALIZED_STRING_CATALOG_H
+#define LOCALIZED_STRING_CATALOG_H
+
+#include <cstdint>
+#include <string>
+#include "libs/XMLHelper/MappedFile.h"
+#include "StringCatalogFormat.h"
+
+//UTF-32 string, with the same code unit type as sf::String, so that it can build one without decoding
+typedef std::basic_string<std::uint32_t> Utf32String;
+
+/**
+ * The LocalizedString struct points to a localized UTF-8 value
+ * owned by its catalog, followed by a null character
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct LocalizedString
+{
+    const char* utf8;
+    std::size_t length;
+};
+
+/**
+ * The LocalizedStringCatalog class holds all strings of a language
+ * in the binary string catalog format, looked up by id with a binary search.
+ *
+ * A compiled catalog, generated at build time by the string catalog compiler,
+ * is mapped in memory without any parsing. \n
+ * A language file is parsed then compiled in memory, it contains lines of this style:
+ * <string name="label" value="value" /> inside a root 'resources' node.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class LocalizedStringCatalog
+{
+public:
+    //=== CTORs / DTORs
+    LocalizedStringCatalog();
+    LocalizedStringCatalog(const LocalizedStringCatalog&) = delete;
+    LocalizedStringCatalog& operator=(const LocalizedStringCatalog&) = delete;
+
+    //=== GETTERS
+    const std::string& getFilename() const;
+    std::size_t getSize() const;
+
+    //=== METHODS
+    bool load(const std::string& filename);
+    bool loadCompiled(const std::string& filename);
+    bool find(StringId id, LocalizedString& result) const;
+    static bool readLanguageFile(const std::string& filename, StringCatalogFormat::Entries& entries);
+    static Utf32String decodeUtf8(const char* utf8, std::size_t length);
+    static Utf32String decodeUtf8(const std::string& utf8);
+
+private:
+    //=== ATTRIBUTES
+    std::string m_filename;
+    Bokoblin::XMLUtils::MappedFile m_file;
+    std::string m_content;
+    StringCatalogView m_view;
+
+    //=== METHODS
+    void clear();
+};
+
+#endif
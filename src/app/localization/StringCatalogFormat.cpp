@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <map>
+#include "StringCatalogFormat.h"
+#include "app/model/utils/StringHash.h"
+
+using std::string;
+
+constexpr std::uint32_t StringCatalogFormat::VERSION;
+constexpr std::size_t StringCatalogFormat::HEADER_SIZE;
+
+namespace
+{
+const char MAGIC[] = {'B', 'K', 'S', 'C'};
+
+void writeInteger(std::ostream& stream, std::uint32_t value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+}
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Write a string catalog
+ * @details When a label is defined several times, its first value is kept
+ *
+ * @param stream the binary stream to write to
+ * @param entries the labels and their UTF-8 values
+ * @param error the reason of the failure, if any
+ * @return true if the catalog was written, false if two labels have the same id
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool StringCatalogFormat::write(std::ostream& stream, const Entries& entries, string& error)
+{
+    std::map<StringId, const std::pair<string, string>*> sortedEntries;
+
+    for (const std::pair<string, string>& entry : entries) {
+        const auto inserted = sortedEntries.emplace(hash(entry.first), &entry);
+        if (!inserted.second && inserted.first->second->first != entry.first) {
+            error = "labels \"" + inserted.first->second->first + "\" and \"" + entry.first + "\" have the same id";
+            return false;
+        }
+    }
+
+    std::uint32_t textsSize = 0;
+    for (const auto& entry : sortedEntries) {
+        textsSize += static_cast<std::uint32_t>(entry.second->second.size() + 1);
+    }
+
+    stream.write(MAGIC, sizeof(MAGIC));
+    writeInteger(stream, VERSION);
+    writeInteger(stream, static_cast<std::uint32_t>(sortedEntries.size()));
+    writeInteger(stream, textsSize);
+
+    for (const auto& entry : sortedEntries) {
+        writeInteger(stream, entry.first);
+    }
+
+    std::uint32_t offset = 0;
+    for (const auto& entry : sortedEntries) {
+        writeInteger(stream, offset);
+        offset += static_cast<std::uint32_t>(entry.second->second.size() + 1);
+    }
+    writeInteger(stream, offset);
+
+    for (const auto& entry : sortedEntries) {
+        stream.write(entry.second->second.c_str(), static_cast<std::streamsize>(entry.second->second.size() + 1));
+    }
+
+    return stream.good();
+}
+
+/**
+ * @brief Read a string catalog, checking its magic, version and tables
+ * @details The content must be aligned on 32 bits, as mapped files and allocated buffers are
+ *
+ * @param data the catalog content, kept alive while the view is used
+ * @param size the catalog content size
+ * @param view the view to fill
+ * @return true if a valid catalog was read
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool StringCatalogFormat::read(const char* data, std::size_t size, StringCatalogView& view)
+{
+    if (data == nullptr || size < HEADER_SIZE || reinterpret_cast<std::uintptr_t>(data) % sizeof(std::uint32_t) != 0
+            || !std::equal(MAGIC, MAGIC + sizeof(MAGIC), data)) {
+        return false;
+    }
+
+    const auto header = reinterpret_cast<const std::uint32_t*>(data);
+    const std::uint32_t count = header[2];
+    const std::uint32_t textsSize = header[3];
+    const std::uint64_t tablesSize = (2 * static_cast<std::uint64_t>(count) + 1) * sizeof(std::uint32_t);
+
+    if (header[1] != VERSION || HEADER_SIZE + tablesSize + textsSize != size) {
+        return false;
+    }
+
+    const std::uint32_t* ids = header + HEADER_SIZE / sizeof(std::uint32_t);
+    const std::uint32_t* offsets = ids + count;
+    const char* texts = data + HEADER_SIZE + tablesSize;
+
+    if (offsets[0] != 0 || offsets[count] != textsSize) {
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < count; i++) {
+        if ((i > 0 && ids[i - 1] >= ids[i]) || offsets[i] >= offsets[i + 1] || texts[offsets[i + 1] - 1] != '\0') {
+            return false;
+        }
+    }
+
+    view.count = count;
+    view.ids = ids;
+    view.offsets = offsets;
+    view.texts = texts;
+    return true;
+}
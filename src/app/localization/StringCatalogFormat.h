@@ -0,0 +1,73 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef STRING_CATALOG_FORMAT_H
+#define STRING_CATALOG_FORMAT_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//Identifier of a localized string: the hash of its label, see StringHash.h
+typedef unsigned int StringId;
+
+/**
+ * @struct StringCatalogView
+ * @details Tables of a compiled string catalog, pointing into its content
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct StringCatalogView
+{
+    std::uint32_t count;
+    const std::uint32_t* ids;
+    const std::uint32_t* offsets;
+    const char* texts;
+};
+
+/**
+ * @class StringCatalogFormat
+ * @details Read and write the binary string catalog format, all values being 32 bits
+ * in the byte order of the platform the catalog is compiled for: \n
+ * - header: "BKSC" magic, version, strings count, texts size \n
+ * - string ids (label hashes), sorted \n
+ * - texts offsets, with one more entry than strings, the last one being the texts size \n
+ * - texts: the UTF-8 values, each followed by a null character.
+ *
+ * Reading only checks the tables and points into the content, no string is copied.
+ * A catalog of another byte order is rejected as its version doesn't match.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class StringCatalogFormat
+{
+public:
+    //=== TYPEDEFS
+    typedef std::vector<std::pair<std::string, std::string>> Entries;
+
+    //=== METHODS
+    static bool write(std::ostream& stream, const Entries& entries, std::string& error);
+    static bool read(const char* data, std::size_t size, StringCatalogView& view);
+
+    //=== CONSTANTS
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr std::size_t HEADER_SIZE = 16;
+};
+
+#endif
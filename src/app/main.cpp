@@ -17,17 +17,64 @@ limitations under the License.
 #include "app/view/views/SplashScreenView.h"
 #include "app/view/views/MenuView.h"
 #include "app/view/views/GameView.h"
+#include "libs/Logger/Tracer.h"
 
 using Bokoblin::SimpleLogger::Logger;
+using Bokoblin::SimpleLogger::Tracer;
 namespace ViewResources = Bokoblin::BokoRunner::Resources::View;
 
 /**
- * Initializes the application and controls its loop
+ * Runs a frame of a model and its view, measuring each phase
+ *
+ * @param frameProfiler the profiler recording the phases
+ * @param model the model
+ * @param view the view
+ * @param event the event object
+ * @return false if the view stops handling events
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+static bool runFrame(FrameProfiler& frameProfiler, AbstractModel& model, AbstractView& view, sf::Event& event)
+{
+    frameProfiler.beginFrame();
+    bool isHandlingEvents;
+
+    {
+        PhaseTimer timer(&frameProfiler, PHASE_HANDLE_EVENTS);
+        isHandlingEvents = view.handleEvents(event);
+    }
+    if (isHandlingEvents) {
+        {
+            PhaseTimer timer(&frameProfiler, PHASE_NEXT_STEP);
+            model.nextStep();
+        }
+        {
+            PhaseTimer timer(&frameProfiler, PHASE_SYNCHRONIZE);
+            view.synchronize();
+        }
+        PhaseTimer timer(&frameProfiler, PHASE_DRAW);
+        view.draw();
+    }
+
+    frameProfiler.endFrame();
+    return isHandlingEvents;
+}
+
+/**
+ * Initializes the application and controls its loop.
+ * With "--record FILE", each played game is recorded,
+ * overwriting the previous one, to be replayed by the CLI target.
+ * Frame phase timings are logged on exit, and with "--frame-timings FILE",
+ * each frame's timings are also written to a CSV file.
+ * With "--trace FILE", scoped timers are written on exit to a Chrome trace file,
+ * when tracing is compiled in.
+ * All language catalogs are preloaded in background for instant language switch.
  *
  * @author Arthur, Florian
- * @date 21/02/16 - 12/10/18
+ * @date 21/02/16 - 17/10/2026
  */
-int main() //TODO [2.2.x] App class with logic -- main must only uses it + check arguments (for CLI)
+int main(int argc, char* argv[]) //TODO [2.2.x] App class with logic -- main must only uses it + check arguments (for CLI)
 {
     //=== Initialize window
 
@@ -45,11 +92,13 @@ int main() //TODO [2.2.x] App class with logic -- main must only uses it + check
 
     AppCore appCore;
     Logger::setLoggerFile("./boko_runner.log");
+    Logger::setOverflowPolicy(Bokoblin::SimpleLogger::LOG_DROP);
     PersistenceManager::initContext(appCore);
     PersistenceManager::fetchConfiguration();
     PersistenceManager::fetchStatistics();
     PersistenceManager::fetchLeaderboard();
     LocalizationManager::initContext(appCore);
+    LocalizationManager::preloadCatalogs();
 
     mdsf::Config::printError = Logger::printError;
     AppTextManager textManager(&appCore, ViewResources::SCREEN_WIDTH, ViewResources::SCREEN_HEIGHT);
@@ -58,6 +107,23 @@ int main() //TODO [2.2.x] App class with logic -- main must only uses it + check
 
     appCore.setAppState(SPLASH);
     sf::Event event = sf::Event();
+    std::string recordPath;
+    FrameProfiler frameProfiler(std::chrono::microseconds(1000000 / ViewResources::APP_FRAMERATE));
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::string(argv[i]) == "--record") {
+            recordPath = argv[i + 1];
+        } else if (std::string(argv[i]) == "--frame-timings") {
+            frameProfiler.openCsv(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--trace") {
+            if (Tracer::isCompiled()) {
+                Tracer::setThreadName("main");
+                Tracer::setOutputFile(argv[i + 1]);
+            } else {
+                Logger::printWarning("Tracing isn't compiled in, ignoring \"--trace\" (see ENABLE_TRACING)");
+            }
+        }
+    }
 
     //=== Program loop
 
@@ -66,31 +132,25 @@ int main() //TODO [2.2.x] App class with logic -- main must only uses it + check
             SplashScreenModel splashModel(&appCore);
             SplashScreenView splashView(&window, &textManager, &splashModel);
 
-            while (appCore.getAppState() == SPLASH && splashView.handleEvents(event)) {
-                splashModel.nextStep();
-                splashView.synchronize();
-                splashView.draw();
-            }
+            while (appCore.getAppState() == SPLASH && runFrame(frameProfiler, splashModel, splashView, event)) {}
         }
         if (appCore.getAppState() == MENU) {
             MenuModel menuModel(&appCore);
             MenuView menuView(&window, &textManager, &menuModel);
 
-            while (appCore.getAppState() == MENU && menuView.handleEvents(event)) {
-                menuModel.nextStep();
-                menuView.synchronize();
-                menuView.draw();
-            }
+            while (appCore.getAppState() == MENU && runFrame(frameProfiler, menuModel, menuView, event)) {}
         }
         if (appCore.getAppState() == GAME) {
+            InputRecorder inputRecorder;
             GameModel gameModel(ViewResources::SCREEN_WIDTH, ViewResources::SCREEN_HEIGHT, &appCore);
             GameView gameView(&window, &textManager, &gameModel);
+            gameView.setFrameProfiler(&frameProfiler);
 
-            while (appCore.getAppState() == GAME && gameView.handleEvents(event)) {
-                gameModel.nextStep();
-                gameView.synchronize();
-                gameView.draw();
+            if (!recordPath.empty() && inputRecorder.open(recordPath, gameModel.getReplayHeader())) {
+                gameModel.setInputRecorder(&inputRecorder);
             }
+
+            while (appCore.getAppState() == GAME && runFrame(frameProfiler, gameModel, gameView, event)) {}
         }
         if (appCore.getAppState() == QUIT) {
             PersistenceManager::updatePersistence();
@@ -98,6 +158,8 @@ int main() //TODO [2.2.x] App class with logic -- main must only uses it + check
         }
     }
 
+    frameProfiler.logReport();
+    LocalizationManager::waitForPreloading();
     PersistenceManager::closeContext();
     LocalizationManager::closeContext();
 
@@ -16,19 +16,176 @@ limitations under the License.
 #include <app/model/models/SplashScreenModel.h>
 #include <app/model/models/MenuModel.h>
 #include <app/model/models/GameModel.h>
+#include <app/model/simulation/SimulationRunner.h>
+#include <libs/Logger/Tracer.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <thread>
 
 using Bokoblin::SimpleLogger::Logger;
+using Bokoblin::SimpleLogger::LOG_DEBUG;
+using Bokoblin::SimpleLogger::LOG_INFO;
+using Bokoblin::SimpleLogger::LOG_WARNING;
+using Bokoblin::SimpleLogger::LOG_ERROR;
+using Bokoblin::SimpleLogger::Tracer;
 
 static const int SCENE_WIDTH = 900;
 static const int SCENE_HEIGHT = 600;
+static const unsigned long DEFAULT_MAX_STEPS = 54000; //30 simulated minutes at 30 steps per second
 
 /**
- * Initializes the application and controls its loop
+ * Runs headless games as fast as possible on worker threads and prints their throughput and results.
+ * Usage: --games N [--difficulty easy|hard|all] [--input idle|random|bot] [--max-steps N] [--threads N] [--seed N]
+ * [--record FILE] [--log-level debug|info|warning|error] [--trace FILE]
+ * Games reaching the step limit are ended, 0 disabling the limit.
+ * With a record file, the first game is recorded to be replayed with --replay.
+ * With "all", a report is printed for each difficulty.
+ * Game i uses the seed N + i, the first seed being random by default.
+ *
+ * @param appCore the app's core, providing the default difficulty
+ * @param argc the number of arguments
+ * @param argv the arguments
+ * @return the exit status
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+static int runSimulations(const AppCore& appCore, int argc, char* argv[])
+{
+    unsigned int gameCount = 0;
+    unsigned long maxSteps = DEFAULT_MAX_STEPS;
+    unsigned int threadCount = std::thread::hardware_concurrency();
+    std::uint64_t seed = RandomGenerator::generateSeed();
+    SimulationInput input = BOT_INPUT;
+    std::string recordPath;
+    std::vector<Difficulty> difficulties = {static_cast<Difficulty>(appCore.getDifficulty())};
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const char* option = argv[i];
+        const char* value = argv[i + 1];
+
+        if (strcmp(option, "--games") == 0) {
+            gameCount = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+        } else if (strcmp(option, "--max-steps") == 0) {
+            maxSteps = strtoul(value, nullptr, 10);
+        } else if (strcmp(option, "--seed") == 0) {
+            seed = strtoull(value, nullptr, 10);
+        } else if (strcmp(option, "--record") == 0) {
+            recordPath = value;
+        } else if (strcmp(option, "--threads") == 0) {
+            threadCount = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+        } else if (strcmp(option, "--difficulty") == 0) {
+            if (strcmp(value, "all") == 0) {
+                difficulties = {EASY, HARD};
+            } else {
+                difficulties = {strcmp(value, "hard") == 0 ? HARD : EASY};
+            }
+        } else if (strcmp(option, "--log-level") == 0) {
+            Logger::setLevel(strcmp(value, "debug") == 0 ? LOG_DEBUG : strcmp(value, "warning") == 0 ? LOG_WARNING
+                    : strcmp(value, "error") == 0 ? LOG_ERROR : LOG_INFO);
+        } else if (strcmp(option, "--trace") == 0) {
+            if (!Tracer::isCompiled()) {
+                std::cerr << "Tracing isn't compiled in, build with ENABLE_TRACING to use --trace" << std::endl;
+                return EXIT_FAILURE;
+            }
+            Tracer::setThreadName("main");
+            Tracer::setOutputFile(value);
+        } else if (strcmp(option, "--input") == 0) {
+            input = strcmp(value, "idle") == 0 ? IDLE_INPUT : strcmp(value, "random") == 0 ? RANDOM_INPUT : BOT_INPUT;
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (gameCount == 0) {
+        std::cerr << "Usage: " << argv[0] << " --games N [--difficulty easy|hard|all] [--input idle|random|bot]"
+                  << " [--max-steps N] [--threads N] [--seed N] [--record FILE]"
+                  << " [--log-level debug|info|warning|error] [--trace FILE]" << std::endl;
+        std::cerr << "       " << argv[0] << " --replay FILE" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    SimulationRunner runner(SCENE_WIDTH, SCENE_HEIGHT, input, maxSteps, threadCount, seed);
+    runner.setRecordPath(recordPath);
+
+    for (const Difficulty& difficulty : difficulties) {
+        runner.clearResults();
+        runner.run(gameCount, difficulty);
+
+        std::cout << "=== Difficulty: " << (difficulty == HARD ? "hard" : "easy") << std::endl;
+        runner.printReport(std::cout);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Replays a recorded game without view and prints its results,
+ * which are the ones of the recorded game.
+ * Usage: --replay FILE
+ *
+ * @param appCore the app's core, configured from the recording
+ * @param path the recording's path
+ * @return the exit status
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+static int replayGame(AppCore& appCore, const char* path)
+{
+    InputReplay inputReplay;
+    if (!inputReplay.load(path)) {
+        std::cerr << "Unable to load the replay: " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const ReplayHeader& header = inputReplay.getHeader();
+    appCore.setDifficulty(static_cast<Difficulty>(header.difficulty));
+
+    GameModel gameModel(header.width, header.height, &appCore, header.seed);
+    appCore.setActivatedItemsArray(std::set<std::string>(header.activatedItems.begin(),
+                                                         header.activatedItems.end()));
+    gameModel.resolveActivatedItems();
+    gameModel.setInputReplay(&inputReplay);
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while ((gameModel.getGameState() == RUNNING || gameModel.getGameState() == RUNNING_SLOWLY)
+            && !inputReplay.isFinished()) {
+        gameModel.simulateStep();
+        gameModel.clearNewMovableElementList();
+        gameModel.clearRemovedMovableElementList();
+    }
+    const double elapsedSeconds = std::max(std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count(), 1e-9);
+
+    //A recording ending before game over comes from a game ended at the step limit
+    if (gameModel.getGameState() != OVER) {
+        gameModel.endGame();
+    }
+
+    const GameCounters& gameCounters = appCore.getGameCounters();
+    std::cout << "Replayed steps: " << gameModel.getStepCount() << "/" << inputReplay.getStepCount()
+              << ", seed: " << header.seed << ", difficulty: " << (header.difficulty == HARD ? "hard" : "easy")
+              << std::endl;
+    std::cout << "Score: " << gameCounters.get(CURRENT_SCORE) << ", distance: " << gameCounters.get(CURRENT_DISTANCE)
+              << ", coins: " << gameCounters.get(CURRENT_COINS) << std::endl;
+    std::cout << "Throughput: " << gameModel.getStepCount() / elapsedSeconds << " steps/s" << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * Initializes the application and controls its loop.
+ * When arguments are given, headless games are simulated
+ * or a recorded game is replayed instead, without saving anything.
  *
  * @author Arthur, Florian
- * @date 21/02/16 - 12/10/18
+ * @date 21/02/16 - 17/10/2026
  */
-int main() //TODO [2.2.x] Complete CLI app (see shelved idea)
+int main(int argc, char* argv[]) //TODO [2.2.x] Complete CLI app (see shelved idea)
 {
     //=== Initialize app data and text
 
@@ -39,6 +196,15 @@ int main() //TODO [2.2.x] Complete CLI app (see shelved idea)
     PersistenceManager::fetchStatistics();
     PersistenceManager::fetchLeaderboard();
 
+    if (argc > 1) {
+        const int status = argc == 3 && strcmp(argv[1], "--replay") == 0
+                ? replayGame(appCore, argv[2])
+                : runSimulations(appCore, argc, argv);
+        PersistenceManager::closeContext();
+        LocalizationManager::closeContext();
+        return status;
+    }
+
     //=== Initialize app state, and event object
 
     appCore.setAppState(SPLASH);
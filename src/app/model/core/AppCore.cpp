@@ -1,3 +1,4 @@
+#include <app/localization/LocalizedStringIds.h>
 #include <app/persistence/PersistenceManager.h>
 
 using std::string;
@@ -5,6 +6,24 @@ using std::to_string;
 using Bokoblin::SimpleLogger::Logger;
 namespace ViewResources = Bokoblin::BokoRunner::Resources::Model;
 
+namespace
+{
+struct ShopItemFlagEntry
+{
+    const char* id;
+    ShopItemFlag flag;
+};
+
+const ShopItemFlagEntry SHOP_ITEM_FLAGS[] = {
+        {"shop_doubler", SHOP_DOUBLER},
+        {"shop_shield_plus", SHOP_SHIELD_PLUS},
+        {"shop_mega_plus", SHOP_MEGA_PLUS},
+        {"shop_fly_plus", SHOP_FLY_PLUS},
+        {"shop_morphball_skin", SHOP_MORPHBALL_SKIN},
+        {"shop_pokeball_skin", SHOP_POKEBALL_SKIN}
+};
+}
+
 //------------------------------------------------
 //          CONSTRUCTOR / DESTRUCTOR
 //------------------------------------------------
@@ -14,9 +33,11 @@ namespace ViewResources = Bokoblin::BokoRunner::Resources::Model;
  * by initializing all its data
  *
  * @author Arthur
- * @date 02/05/16 - 04/02/18
+ * @date 02/05/16 - 17/10/2026
  */
-AppCore::AppCore() : m_appState{SPLASH}
+AppCore::AppCore() :
+        m_appState{SPLASH}, m_activatedItemsFlags{SHOP_NONE}, m_statCounters(STAT_COUNTER_KEYS),
+        m_gameCounters(GAME_COUNTER_KEYS)
 {
     initWithDefaultValues();
 }
@@ -43,12 +64,15 @@ int AppCore::getWallet() const { return m_wallet;}
 bool AppCore::isMenuMusicEnabled() const { return m_isMenuMusicEnabled; }
 bool AppCore::isGameMusicEnabled() const { return m_isGameMusicEnabled; }
 std::vector<ShopItem*> AppCore::getShopItemsArray() const { return m_shopItemsArray; }
-std::map<string, int> AppCore::getStatsMap() const { return m_statsMap; }
-std::map<string, int> AppCore::getGameMap() const { return m_gameMap; }
+const StatCounters& AppCore::getStatCounters() const { return m_statCounters; }
+const GameCounters& AppCore::getGameCounters() const { return m_gameCounters; }
+int AppCore::getGameValue(const GameCounter& counter) const { return m_gameCounters.get(counter); }
 bool AppCore::isScoreEasyArrayEmpty() const { return m_scoresEasyArray.empty(); }
 bool AppCore::isScoreHardArrayEmpty() const { return m_scoresHardArray.empty(); }
 string AppCore::getLanguage() const { return m_currentLanguage; }
 string AppCore::getPlayerSkin() const { return m_currentPlayerSkin; }
+std::set<string> AppCore::getActivatedItemsArray() const { return m_activatedItemsArray; }
+unsigned int AppCore::getActivatedItemsFlags() const { return m_activatedItemsFlags; }
 string AppCore::getPersistenceContext() const { return PersistenceManager::getContextLocation(); }
 
 
@@ -60,6 +84,25 @@ void AppCore::setAppState(const AppState& state) { m_appState = state; }
 void AppCore::setLanguage(const string& language) { m_currentLanguage = language; }
 void AppCore::setPlayerSkin(const string& skin) { m_currentPlayerSkin = skin; }
 void AppCore::setDifficulty(const Difficulty& difficulty) { m_currentDifficulty = difficulty; }
+void AppCore::setGameValue(const GameCounter& counter, int value) { m_gameCounters.set(counter, value); }
+
+/**
+ * Replaces all activated items
+ *
+ * @param activatedItems the ids of the activated items
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void AppCore::setActivatedItemsArray(const std::set<string>& activatedItems)
+{
+    m_activatedItemsArray.clear();
+    m_activatedItemsFlags = SHOP_NONE;
+
+    for (const string& itemId : activatedItems) {
+        addNewActivatedBonus(itemId);
+    }
+}
 
 
 //------------------------------------------------
@@ -70,24 +113,27 @@ void AppCore::setDifficulty(const Difficulty& difficulty) { m_currentDifficulty
  * Saves the current game results to app data.
  *
  * @author Arthur
- * @date 02/05/16 - 13/01/19
+ * @date 02/05/16 - 17/10/2026
  */
 void AppCore::saveCurrentGame()
 {
+    const int coins = m_gameCounters.get(CURRENT_COINS);
+    const int distance = m_gameCounters.get(CURRENT_DISTANCE);
+    const int enemiesDestroyed = m_gameCounters.get(CURRENT_ENEMIES_DESTROYED);
+
     //add current game values to total values
-    m_statsMap["total_coins_collected"] += m_gameMap["coin_number"];
-    m_statsMap["total_distance_travelled"] += m_gameMap["distance"];
-    m_statsMap["total_enemies_destroyed"] += m_gameMap["enemies_destroyed"];
-    m_wallet += m_gameMap["coin_number"];
-    addNewScore(m_gameMap["score"]);
+    m_statCounters.increase(TOTAL_COINS_COLLECTED, coins);
+    m_statCounters.increase(TOTAL_DISTANCE_TRAVELLED, distance);
+    m_statCounters.increase(TOTAL_ENEMIES_DESTROYED, enemiesDestroyed);
+    m_wallet += coins;
+    addNewScore(m_gameCounters.get(CURRENT_SCORE));
 
     //update per game stats if better
-    m_statsMap["per_game_coins_collected"] =
-            std::max(m_gameMap["coin_number"], m_statsMap["per_game_coins_collected"]);
-    m_statsMap["per_game_distance_travelled"] =
-            std::max(m_gameMap["distance"], m_statsMap["per_game_distance_travelled"]);
-    m_statsMap["per_game_enemies_destroyed"] =
-            std::max(m_gameMap["enemies_destroyed"], m_statsMap["per_game_enemies_destroyed"]);
+    m_statCounters.set(PER_GAME_COINS_COLLECTED, std::max(coins, m_statCounters.get(PER_GAME_COINS_COLLECTED)));
+    m_statCounters.set(PER_GAME_DISTANCE_TRAVELLED,
+                       std::max(distance, m_statCounters.get(PER_GAME_DISTANCE_TRAVELLED)));
+    m_statCounters.set(PER_GAME_ENEMIES_DESTROYED,
+                       std::max(enemiesDestroyed, m_statCounters.get(PER_GAME_ENEMIES_DESTROYED)));
 
     Logger::printInfo("Current game saved");
 }
@@ -125,16 +171,13 @@ void AppCore::addNewScore(int score)
  * Resets current game to create a new one
  *
  * @author Arthur
- * @date 02/05/16 - 13/01/19
+ * @date 02/05/16 - 17/10/2026
  */
 void AppCore::launchNewGame()
 {
     //for launching a new game
-    m_statsMap["total_games_played"] += 1;
-    m_gameMap["coin_number"] = 0;
-    m_gameMap["distance"] = 0;
-    m_gameMap["enemies_destroyed"] = 0;
-    m_gameMap["score"] = 0;
+    m_statCounters.increase(TOTAL_GAMES_PLAYED, 1);
+    m_gameCounters.reset();
 }
 
 
@@ -161,12 +204,12 @@ void AppCore::clearLeaderboard()
  * Clears app's all data
  *
  * @author Arthur
- * @date 22/12/16 - 04/02/18
+ * @date 22/12/16 - 17/10/2026
  */
 void AppCore::clearAppData()
 {
     initWithDefaultValues();
-    Logger::Logger::printInfo("App data was successfully cleared");
+    Logger::printInfo("App data was successfully cleared");
 }
 
 
@@ -187,17 +230,34 @@ bool AppCore::findActivatedItem(const string& itemLabel)
 }
 
 
+/**
+ * Checks if a shop item is activated, without any lookup
+ *
+ * @param item the item flag
+ * @return true if the item is activated
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool AppCore::isItemActivated(const ShopItemFlag& item) const
+{
+    return (m_activatedItemsFlags & item) != 0;
+}
+
+
 /**
  * Add a newly activated bonus to the item array
+ * and to the activated items flags
  *
  * @param itemLabel the item label
  *
  * @author Arthur
- * @date 04/02/18
+ * @date 04/02/18 - 17/10/2026
  */
 void AppCore::addNewActivatedBonus(const string& itemLabel)
 {
     m_activatedItemsArray.insert(itemLabel);
+    m_activatedItemsFlags |= findShopItemFlag(itemLabel);
 }
 
 /**
@@ -207,13 +267,36 @@ void AppCore::addNewActivatedBonus(const string& itemLabel)
  * @param flattenedEnemiesBonus the bonus for all enemies flattened in the last game
  *
  * @author Arthur
- * @date ?? - 13/01/19
+ * @date ?? - 17/10/2026
  */
 void AppCore::calculateFinalScore(float speed, int flattenedEnemiesBonus)
 {
-    float distanceSubScore = speed * m_gameMap.at("distance");
-    int coinSubScore = COIN_MULTIPLIER * m_gameMap.at("coin_number");
-    m_gameMap.at("score") = static_cast<int>(distanceSubScore + coinSubScore + flattenedEnemiesBonus);
+    float distanceSubScore = speed * m_gameCounters.get(CURRENT_DISTANCE);
+    int coinSubScore = COIN_MULTIPLIER * m_gameCounters.get(CURRENT_COINS);
+    m_gameCounters.set(CURRENT_SCORE, static_cast<int>(distanceSubScore + coinSubScore + flattenedEnemiesBonus));
+}
+
+
+/**
+ * Maps a shop item id to its flag,
+ * done once when items are loaded or bought
+ *
+ * @param itemId the shop item id
+ * @return the item flag, SHOP_NONE if the id is unknown
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+ShopItemFlag AppCore::findShopItemFlag(const string& itemId)
+{
+    for (const ShopItemFlagEntry& entry : SHOP_ITEM_FLAGS) {
+        if (itemId == entry.id) {
+            return entry.flag;
+        }
+    }
+
+    Logger::printWarning("Unknown shop item: ", itemId);
+    return SHOP_NONE;
 }
 
 
@@ -225,7 +308,7 @@ void AppCore::calculateFinalScore(float speed, int flattenedEnemiesBonus)
  * @return a string containing scores of a given difficulty
  *
  * @author Arthur
- * @date 23/10/16 - 13/01/19
+ * @date 23/10/16 - 17/10/2026
  */
 string AppCore::stringifyLeaderboard(const Difficulty& difficulty) const
 {
@@ -233,10 +316,10 @@ string AppCore::stringifyLeaderboard(const Difficulty& difficulty) const
     std::set<int> scoresArray;
 
     if (difficulty == EASY && !isScoreEasyArrayEmpty()) {
-        result = LocalizationManager::fetchLocalizedString("config_easy_mode") + " :\n";
+        result = LocalizationManager::fetchLocalizedStringById(StringIds::CONFIG_EASY_MODE) + " :\n";
         scoresArray = m_scoresEasyArray;
     } else if (difficulty == HARD && !isScoreHardArrayEmpty()) {
-        result = LocalizationManager::fetchLocalizedString("config_hard_mode") + " :\n";
+        result = LocalizationManager::fetchLocalizedStringById(StringIds::CONFIG_HARD_MODE) + " :\n";
         scoresArray = m_scoresHardArray;
     }
 
@@ -262,7 +345,7 @@ string AppCore::stringifyLeaderboard(const Difficulty& difficulty) const
  * in case it hasn't been initialized
  *
  * @author Arthur
- * @date 04/02/18 - 13/01/19
+ * @date 04/02/18 - 17/10/2026
  */
 void AppCore::initWithDefaultValues()
 {
@@ -273,18 +356,14 @@ void AppCore::initWithDefaultValues()
     m_isGameMusicEnabled = true;
     m_wallet = 0;
 
-    for (auto elem : m_statsMap) {
-        elem.second = 0;
-    }
-
-    for (auto elem : m_gameMap) {
-        elem.second = 0;
-    }
+    m_statCounters.reset();
+    m_gameCounters.reset();
 
     m_scoresEasyArray.clear();
     m_scoresHardArray.clear();
     m_shopItemsArray.clear();
     m_activatedItemsArray.clear();
+    m_activatedItemsFlags = SHOP_NONE;
 }
 
 /**
@@ -325,9 +404,9 @@ void AppCore::decreaseWallet(int amount)
  * @param amount the amount to add
  *
  * @author Arthur
- * @date 02/05/16 - 13/01/19
+ * @date 02/05/16 - 17/10/2026
  */
-void AppCore::increaseCurrentCoinsCollected(int amount) { m_gameMap.at("coin_number") += amount; }
+void AppCore::increaseCurrentCoinsCollected(int amount) { m_gameCounters.increase(CURRENT_COINS, amount); }
 
 
 /**
@@ -335,20 +414,21 @@ void AppCore::increaseCurrentCoinsCollected(int amount) { m_gameMap.at("coin_num
  * @param amount the amount to add
  *
  * @author Arthur
- * @date 02/05/16 - 13/01/19
+ * @date 02/05/16 - 17/10/2026
  */
-void AppCore::increaseCurrentDistance(float amount) {
-    Logger::printWarning(to_string(amount));
-    m_gameMap.at("distance") += static_cast<int>(amount); }
+void AppCore::increaseCurrentDistance(float amount)
+{
+    m_gameCounters.increase(CURRENT_DISTANCE, static_cast<int>(amount));
+}
 
 
 /**
  * Increases the number of enemies killed
  *
  * @author Arthur
- * @date 02/05/16 - 13/01/19
+ * @date 02/05/16 - 17/10/2026
  */
-void AppCore::increaseCurrentFlattenedEnemies() {m_gameMap.at("enemies_destroyed")++; }
+void AppCore::increaseCurrentFlattenedEnemies() { m_gameCounters.increase(CURRENT_ENEMIES_DESTROYED, 1); }
 
 
 /**
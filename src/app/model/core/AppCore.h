@@ -23,8 +23,10 @@ limitations under the License.
 #include "app/localization/LocalizationManager.h"
 #include "app/model/enums/AppState.h"
 #include "app/model/enums/Difficulty.h"
+#include "app/model/enums/ShopItemFlag.h"
 #include "app/model/menu-components/ShopItem.h"
 #include "app/persistence/FileBasedPersistence.h"
+#include "GameCounters.h"
 #include "ModelConstants.h"
 
 /**
@@ -34,10 +36,12 @@ limitations under the License.
  * It allows accessing, modifying app data and state
  * directly or for specific actions involving data changes
  *
- * to do specific actions to the app
+ * to do specific actions to the app. \n
+ * Persistence and localization contexts are bound per thread,
+ * so that several instances can run games concurrently on different threads.
  *
  * @author Arthur
- * @date 02/05/16 - 13/01/19
+ * @date 02/05/16 - 17/10/2026
  */
 class AppCore
 {
@@ -54,12 +58,15 @@ public:
     bool isMenuMusicEnabled() const;
     bool isGameMusicEnabled() const;
     std::vector<ShopItem*> getShopItemsArray() const;
-    std::map<std::string, int> getStatsMap() const;
-    std::map<std::string, int> getGameMap() const;
+    const StatCounters& getStatCounters() const;
+    const GameCounters& getGameCounters() const;
+    int getGameValue(const GameCounter& counter) const;
     bool isScoreEasyArrayEmpty() const;
     bool isScoreHardArrayEmpty() const;
     std::string getLanguage() const;
     std::string getPlayerSkin() const;
+    std::set<std::string> getActivatedItemsArray() const;
+    unsigned int getActivatedItemsFlags() const;
     //FIXME [2.0.x] LINKED TO FILE BASED, WE SHALL ABSTRACT THAT ALSO
     virtual std::string getPersistenceContext() const;
 
@@ -68,6 +75,8 @@ public:
     void setDifficulty(const Difficulty& difficulty);
     void setLanguage(const std::string& language);
     void setPlayerSkin(const std::string& skin);
+    void setGameValue(const GameCounter& counter, int value);
+    void setActivatedItemsArray(const std::set<std::string>& activatedItems);
 
     //=== METHODS
     void addNewScore(int score);
@@ -76,8 +85,10 @@ public:
     void clearLeaderboard();
     void clearAppData();
     bool findActivatedItem(const std::string& itemLabel);
+    bool isItemActivated(const ShopItemFlag& item) const;
     void addNewActivatedBonus(const std::string& itemLabel);
     void calculateFinalScore(float speed, int flattenedEnemiesBonus);
+    static ShopItemFlag findShopItemFlag(const std::string& itemId);
     std::string stringifyLeaderboard(const Difficulty& difficulty) const;
     void decreaseWallet(int amount);
     void increaseCurrentCoinsCollected(int amount);
@@ -105,8 +116,9 @@ protected:
     std::set<int> m_scoresHardArray;
     std::vector<ShopItem*> m_shopItemsArray;
     std::set<std::string> m_activatedItemsArray;
-    std::map<std::string, int> m_statsMap;
-    std::map<std::string, int> m_gameMap;
+    unsigned int m_activatedItemsFlags;
+    StatCounters m_statCounters;
+    GameCounters m_gameCounters;
 
 private:
     friend class FileBasedPersistence; //TODO [2.0.x] Be friend with an abstraction of persistence instead
@@ -0,0 +1,18 @@
+#include "GameCounters.h"
+
+const char* const GAME_COUNTER_KEYS[GAME_COUNTER_COUNT] = {
+        "coin_number",
+        "distance",
+        "enemies_destroyed",
+        "score"
+};
+
+const char* const STAT_COUNTER_KEYS[STAT_COUNTER_COUNT] = {
+        "total_coins_collected",
+        "total_distance_travelled",
+        "total_enemies_destroyed",
+        "total_games_played",
+        "per_game_coins_collected",
+        "per_game_distance_travelled",
+        "per_game_enemies_destroyed"
+};
@@ -0,0 +1,106 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef GAME_COUNTERS_H
+#define GAME_COUNTERS_H
+
+#include <array>
+#include <string>
+#include "app/model/enums/GameCounter.h"
+#include "app/model/enums/StatCounter.h"
+
+/**
+ * @class CounterArray
+ * @details Fixed set of integer counters indexed by an enum,
+ * read and updated without any lookup nor allocation.
+ * Each counter also has a key naming it in persistence files
+ * and logs, only used when loading or saving them.
+ *
+ * @tparam Counter the enum indexing counters
+ * @tparam Count the number of counters
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+template<typename Counter, std::size_t Count>
+class CounterArray
+{
+public:
+    //=== CTORs / DTORs
+
+    /**
+     * @brief Constructor
+     * @details All counters start at zero
+     *
+     * @param keys the key of each counter, in enum order
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    explicit CounterArray(const char* const (& keys)[Count]) : m_keys(keys)
+    {
+        reset();
+    }
+
+    //=== GETTERS
+
+    int get(Counter counter) const { return m_values[counter]; }
+    const char* getKey(Counter counter) const { return m_keys[counter]; }
+    static constexpr std::size_t getCount() { return Count; }
+
+    //=== SETTERS
+
+    void set(Counter counter, int value) { m_values[counter] = value; }
+
+    //=== METHODS
+
+    void increase(Counter counter, int amount) { m_values[counter] += amount; }
+    void reset() { m_values.fill(0); }
+
+    /**
+     * @brief Find the counter named by a key
+     *
+     * @param key the counter key
+     * @param counter the counter to fill
+     * @return true if a counter has this key
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    bool findCounter(const std::string& key, Counter& counter) const
+    {
+        for (std::size_t i = 0; i < Count; i++) {
+            if (key == m_keys[i]) {
+                counter = static_cast<Counter>(i);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    //=== ATTRIBUTES
+    std::array<int, Count> m_values;
+    const char* const* m_keys;
+};
+
+extern const char* const GAME_COUNTER_KEYS[GAME_COUNTER_COUNT];
+extern const char* const STAT_COUNTER_KEYS[STAT_COUNTER_COUNT];
+
+typedef CounterArray<GameCounter, GAME_COUNTER_COUNT> GameCounters;
+typedef CounterArray<StatCounter, STAT_COUNTER_COUNT> StatCounters;
+
+#endif
@@ -15,6 +15,11 @@ extern const std::string RES = "../res/";
 extern const std::string SOURCES = "../src/";
 extern const std::string TESTS = "../test/";
 extern const std::string LOCALIZATION = RES + "strings/";
+#ifdef STRING_CATALOG_ROOT
+extern const std::string STRING_CATALOGS = STRING_CATALOG_ROOT "/";
+#else
+extern const std::string STRING_CATALOGS = LOCALIZATION;
+#endif
 }
 
 //=== Languages
@@ -30,6 +35,7 @@ extern const std::string BOOLEAN_REGEX = "true|false";
 extern const std::string ENGLISH_STRINGS = Folder::LOCALIZATION + "english.xml";
 extern const std::string FRENCH_STRINGS = Folder::LOCALIZATION + "french.xml";
 extern const std::string SPANISH_STRINGS = Folder::LOCALIZATION + "spanish.xml";
+extern const std::string COMPILED_STRINGS_EXTENSION = ".bin";
 
 } //namespace Resources
 } //namespace View
@@ -29,7 +29,7 @@ namespace Resources
  * @brief Provide constants to model classes
  *
  * @author Arthur
- * @date 23/10/16 - 13/07/2019
+ * @date 23/10/16 - 17/10/2026
  */
 namespace Model
 {
@@ -49,6 +49,7 @@ extern const std::string TESTS;
 
 //=== Second-level Folders
 extern const std::string LOCALIZATION;
+extern const std::string STRING_CATALOGS;
 }
 
 //=== Languages
@@ -64,6 +65,7 @@ extern const std::string BOOLEAN_REGEX;
 extern const std::string ENGLISH_STRINGS;
 extern const std::string FRENCH_STRINGS;
 extern const std::string SPANISH_STRINGS;
+extern const std::string COMPILED_STRINGS_EXTENSION;
 
 } //namespace Resources
 } //namespace View
@@ -0,0 +1,40 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef FRAME_PHASE_H
+#define FRAME_PHASE_H
+
+/**
+ * The FramePhase enum defines the parts of a frame whose durations
+ * are measured: the main loop phases, then sub-phases of the game view.
+ * FRAME_PHASE_COUNT is the number of phases.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum FramePhase
+{
+    PHASE_FRAME,
+    PHASE_HANDLE_EVENTS,
+    PHASE_NEXT_STEP,
+    PHASE_SYNCHRONIZE,
+    PHASE_DRAW,
+    PHASE_LINK_ELEMENTS,
+    PHASE_UPDATE_ELEMENTS,
+    PHASE_DRAW_RUNNING_GAME,
+    PHASE_DISPLAY,
+    FRAME_PHASE_COUNT
+};
+
+#endif
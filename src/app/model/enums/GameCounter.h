@@ -0,0 +1,35 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef GAME_COUNTER_H
+#define GAME_COUNTER_H
+
+/**
+ * The GameCounter enum defines the values
+ * counted during the current game.
+ * GAME_COUNTER_COUNT is the number of counters.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum GameCounter
+{
+    CURRENT_COINS,
+    CURRENT_DISTANCE,
+    CURRENT_ENEMIES_DESTROYED,
+    CURRENT_SCORE,
+    GAME_COUNTER_COUNT
+};
+
+#endif
@@ -0,0 +1,35 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef PLAYER_INPUT_H
+#define PLAYER_INPUT_H
+
+/**
+ * The PlayerInput enum defines the different
+ * player actions as bit flags, so that all actions
+ * of a simulation step can be combined in a single value.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum PlayerInput
+{
+    INPUT_NONE = 0,
+    INPUT_LEFT = 1 << 0,
+    INPUT_RIGHT = 1 << 1,
+    INPUT_JUMP = 1 << 2,
+    INPUT_DECELERATE = 1 << 3
+};
+
+#endif
@@ -0,0 +1,37 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef SHOP_ITEM_FLAG_H
+#define SHOP_ITEM_FLAG_H
+
+/**
+ * The ShopItemFlag enum defines the different
+ * shop items as bit flags, so that all items
+ * activated for a game can be combined in a single value.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum ShopItemFlag
+{
+    SHOP_NONE = 0,
+    SHOP_DOUBLER = 1 << 0,
+    SHOP_SHIELD_PLUS = 1 << 1,
+    SHOP_MEGA_PLUS = 1 << 2,
+    SHOP_FLY_PLUS = 1 << 3,
+    SHOP_MORPHBALL_SKIN = 1 << 4,
+    SHOP_POKEBALL_SKIN = 1 << 5
+};
+
+#endif
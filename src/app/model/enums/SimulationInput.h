@@ -0,0 +1,32 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef SIMULATION_INPUT_H
+#define SIMULATION_INPUT_H
+
+/**
+ * The SimulationInput enum defines the different
+ * input policies driving the player of headless games.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum SimulationInput
+{
+    IDLE_INPUT,
+    RANDOM_INPUT,
+    BOT_INPUT
+};
+
+#endif
@@ -0,0 +1,38 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef STAT_COUNTER_H
+#define STAT_COUNTER_H
+
+/**
+ * The StatCounter enum defines the statistics
+ * counted over all games.
+ * STAT_COUNTER_COUNT is the number of counters.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum StatCounter
+{
+    TOTAL_COINS_COLLECTED,
+    TOTAL_DISTANCE_TRAVELLED,
+    TOTAL_ENEMIES_DESTROYED,
+    TOTAL_GAMES_PLAYED,
+    PER_GAME_COINS_COLLECTED,
+    PER_GAME_DISTANCE_TRAVELLED,
+    PER_GAME_ENEMIES_DESTROYED,
+    STAT_COUNTER_COUNT
+};
+
+#endif
@@ -0,0 +1,37 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef STEP_EVENT_H
+#define STEP_EVENT_H
+
+/**
+ * The StepEvent enum defines, as bit flags, the changes
+ * applied to a running game from outside of its simulation steps
+ * (e.g. by the view), so that they can be recorded and replayed
+ * on the same step as player inputs.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum StepEvent
+{
+    EVENT_NONE = 0,
+    EVENT_TRANSITION_STARTED = 1 << 0,
+    EVENT_TRANSITION_ENDED = 1 << 1,
+    EVENT_TRANSITION_DISABLED = 1 << 2,
+    EVENT_ZONE_CHANGED = 1 << 3,
+    EVENT_SLOWLY_RESUMED = 1 << 4
+};
+
+#endif
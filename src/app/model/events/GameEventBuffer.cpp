@@ -0,0 +1,177 @@
+#include <cstring>
+#include "GameEventBuffer.h"
+
+/**
+ * An event and its sequence number, the event being stored
+ * in atomic words so that it can be read while written
+ */
+struct GameEventBuffer::Slot
+{
+    static constexpr std::size_t WORD_COUNT = (sizeof(GameEvent) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    std::atomic<std::uint64_t> sequence;
+    std::atomic<std::uint64_t> words[WORD_COUNT];
+};
+
+constexpr std::size_t GameEventBuffer::Slot::WORD_COUNT;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ * @details All memory is allocated here, the capacity being rounded up to a power of two
+ *
+ * @param capacity the minimum number of events kept for consumers
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+GameEventBuffer::GameEventBuffer(std::size_t capacity) : m_capacity{1}, m_mask{0}, m_writeIndex{0}
+{
+    while (m_capacity < capacity) {
+        m_capacity <<= 1u;
+    }
+
+    m_slots.reset(new Slot[m_capacity]);
+    m_mask = m_capacity - 1;
+
+    for (std::size_t i = 0; i < m_capacity; i++) {
+        m_slots[i].sequence.store(0, std::memory_order_relaxed);
+        for (std::atomic<std::uint64_t>& word : m_slots[i].words) {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+GameEventBuffer::~GameEventBuffer() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::size_t GameEventBuffer::getCapacity() const { return m_capacity; }
+std::uint64_t GameEventBuffer::getPublishedCount() const { return m_writeIndex.load(std::memory_order_acquire); }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Publish an event, overwriting the oldest one if the buffer is full
+ * @details The slot's sequence is odd while the event is written,
+ * then tells which event the slot holds
+ *
+ * @param event the event to publish
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameEventBuffer::publish(const GameEvent& event)
+{
+    const std::uint64_t index = m_writeIndex.load(std::memory_order_relaxed);
+    Slot& slot = m_slots[index & m_mask];
+    std::uint64_t words[Slot::WORD_COUNT] = {};
+    std::memcpy(words, &event, sizeof(event));
+
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < Slot::WORD_COUNT; i++) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+
+    m_writeIndex.store(index + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Create the cursor of a new consumer, which will only read next events
+ *
+ * @return the new cursor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+GameEventCursor GameEventBuffer::createCursor() const
+{
+    return GameEventCursor{getPublishedCount(), 0};
+}
+
+/**
+ * @brief Read the next event of a consumer
+ *
+ * @param cursor the consumer's cursor, moved after the read event
+ * @param event the event to fill
+ * @return true if an event was read, false if the consumer is up to date
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool GameEventBuffer::poll(GameEventCursor& cursor, GameEvent& event) const
+{
+    while (true) {
+        const std::uint64_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+        if (writeIndex - cursor.next > m_capacity) {
+            cursor.dropped += writeIndex - m_capacity - cursor.next;
+            cursor.next = writeIndex - m_capacity;
+        }
+
+        if (cursor.next == writeIndex) {
+            return false;
+        }
+
+        const bool isRead = read(cursor.next, event);
+        cursor.next++;
+
+        if (isRead) {
+            return true;
+        }
+
+        //The event is being overwritten by a newer one
+        cursor.dropped++;
+    }
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Copy a published event, checking that its slot isn't written meanwhile
+ *
+ * @param index the index of the event
+ * @param event the event to fill
+ * @return true if the event was copied, false if it has been or is being overwritten
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool GameEventBuffer::read(std::uint64_t index, GameEvent& event) const
+{
+    const Slot& slot = m_slots[index & m_mask];
+    const std::uint64_t sequence = 2 * index + 2;
+    std::uint64_t words[Slot::WORD_COUNT];
+
+    if (slot.sequence.load(std::memory_order_acquire) != sequence) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < Slot::WORD_COUNT; i++) {
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+        return false;
+    }
+
+    std::memcpy(&event, words, sizeof(event));
+    return true;
+}
@@ -0,0 +1,99 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef GAME_EVENT_BUFFER_H
+#define GAME_EVENT_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "app/model/enums/GameEventType.h"
+#include "app/model/game-components/ElementHandle.h"
+
+/**
+ * @struct GameEvent
+ * @details Gameplay event of a simulation step, with the element involved if any
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct GameEvent
+{
+    GameEventType type;
+    MovableElementType elementType;
+    ElementHandle handle;
+    unsigned long step;
+};
+
+/**
+ * @struct GameEventCursor
+ * @details Reading position of a consumer in a GameEventBuffer
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct GameEventCursor
+{
+    std::uint64_t next;
+    std::uint64_t dropped;
+};
+
+/**
+ * @class GameEventBuffer
+ * @details Fixed capacity ring buffer of gameplay events, with a single producer
+ * (the game) and any number of consumers (view, audio, statistics, ...).
+ * Each consumer keeps its own cursor and drains new events when it wants to,
+ * so that nobody has to scan game elements to find what happened.
+ *
+ * Publishing never waits nor allocates: the oldest events are overwritten,
+ * a consumer falling more than the capacity behind skipping them as dropped.
+ * Each slot is a seqlock: its sequence number, odd while the event is written,
+ * is checked again once the event is copied, so that consumers don't need a lock
+ * and never read an event being overwritten.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class GameEventBuffer
+{
+public:
+    //=== CTORs / DTORs
+    explicit GameEventBuffer(std::size_t capacity);
+    GameEventBuffer(const GameEventBuffer&) = delete;
+    ~GameEventBuffer();
+
+    //=== GETTERS
+    std::size_t getCapacity() const;
+    std::uint64_t getPublishedCount() const;
+
+    //=== METHODS
+    void publish(const GameEvent& event);
+    GameEventCursor createCursor() const;
+    bool poll(GameEventCursor& cursor, GameEvent& event) const;
+
+private:
+    struct Slot;
+
+    //=== ATTRIBUTES
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_capacity;
+    std::uint64_t m_mask;
+    std::atomic<std::uint64_t> m_writeIndex;
+
+    //=== PRIVATE METHODS
+    bool read(std::uint64_t index, GameEvent& event) const;
+};
+
+#endif
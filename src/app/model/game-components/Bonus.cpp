@@ -7,20 +7,22 @@
 /**
  * @brief Constructor
  *
+ * @param store the store to add the element to
  * @param x the x position
  * @param y the y position
  * @param w the width
  * @param h the height
  * @param mvX the x moving direction
- * @param mvY the y moving direction
+ * @param type the bonus type
  *
  * @author Arthur
- * @date 11/04/2016
+ * @date 11/04/2016 - 17/10/2026
  */
-Bonus::Bonus(float x, float y, float w, float h, float mvX, float mvY) :
-        MovableElement(x, y, w, h, mvX, mvY)
+Bonus::Bonus(MovableElementStore* store, float x, float y, float w, float h, float mvX,
+             const MovableElementType& type) :
+        MovableElement(store, x, y, w, h, mvX)
 {
-    chooseBonusType();
+    m_store->setType(getIndex(), type);
 }
 
 /**
@@ -36,18 +38,7 @@ Bonus::~Bonus() = default;
 //------------------------------------------------
 
 /**
- * @brief Execute the move routine
- *
- * @author Arthur
- * @date 11/04/2016 - 11/07/2019
- */
-void Bonus::move()
-{
-    m_posX -= 1;
-}
-
-/**
- * @brief Select the bonus type following probabilities
+ * @brief Select a bonus type following probabilities
  * @details Here are the probabilities: \n
  *  1-30 : PV+    ~30% \n
  * 31-50 : MEGA   ~20% \n
@@ -55,23 +46,25 @@ void Bonus::move()
  * 66-75 : SLOW   ~10% \n
  * 76-100: SHIELD ~25%
  *
+ * @param randomGenerator the game's random generator
+ * @return the chosen bonus type
+ *
  * @author Arthur
- * @date 11/04/2016 - 10/02/2018
+ * @date 11/04/2016 - 17/10/2026
  */
-void Bonus::chooseBonusType()
+MovableElementType Bonus::chooseBonusType(RandomGenerator& randomGenerator)
 {
-    int result = RandomUtils::getUniformRandomNumber(1, 100);
+    int result = randomGenerator.getUniformRandomNumber(1, 100);
 
     if (result <= 30) {
-        m_elementType = PV_PLUS_BONUS;
+        return PV_PLUS_BONUS;
     } else if (result <= 50) {
-        m_elementType = MEGA_BONUS;
+        return MEGA_BONUS;
     } else if (result <= 65) {
-        m_elementType = FLY_BONUS;
+        return FLY_BONUS;
     } else if (result <= 75) {
-        m_elementType = SLOW_SPEED_BONUS;
+        return SLOW_SPEED_BONUS;
     } else {
-        m_elementType = SHIELD_BONUS;
+        return SHIELD_BONUS;
     }
 }
-
@@ -21,21 +21,21 @@ limitations under the License.
 /**
  * @class Bonus
  * @inherit MovableElement
- * @details Provide a specific moving behaviour and bonus type
+ * @details Provide a specific bonus type
  *
  * @author Arthur
- * @date 11/04/2016 - 12/04/2016
+ * @date 11/04/2016 - 17/10/2026
  */
 class Bonus: public MovableElement
 {
 public:
     //=== CTORs / DTORs
-    Bonus(float x, float y, float w, float h, float mvX, float mvY);
-    ~Bonus() override;
+    Bonus(MovableElementStore* store, float x, float y, float w, float h, float mvX,
+          const MovableElementType& type);
+    ~Bonus();
 
     //=== METHODS
-    void move() override;
-    void chooseBonusType();
+    static MovableElementType chooseBonusType(RandomGenerator& randomGenerator);
 };
 
 #endif
\ No newline at end of file
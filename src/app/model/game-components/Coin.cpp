@@ -7,20 +7,20 @@
 /**
  * @brief Constructor
  *
+ * @param store the store to add the element to
  * @param x the x position
  * @param y the y position
  * @param w the width
  * @param h the height
  * @param mvX the x moving direction
- * @param mvY the y moving direction
  *
  * @author Arthur
- * @date 19/03/2016
+ * @date 19/03/2016 - 17/10/2026
  */
-Coin::Coin(float x, float y, float w, float h, float mvX, float mvY) :
-        MovableElement(x, y, w, h, mvX, mvY)
+Coin::Coin(MovableElementStore* store, float x, float y, float w, float h, float mvX) :
+        MovableElement(store, x, y, w, h, mvX)
 {
-    m_elementType = COIN;
+    m_store->setType(getIndex(), COIN);
 }
 
 /**
@@ -30,18 +30,3 @@ Coin::Coin(float x, float y, float w, float h, float mvX, float mvY) :
  * @date 19/03/2016
  */
 Coin::~Coin() = default;
-
-//------------------------------------------------
-//          METHODS
-//------------------------------------------------
-
-/**
- * @brief Execute the move routine
- *
- * @author Arthur
- * @date 19/03/2016 - 11/07/2019
- */
-void Coin::move()
-{
-    m_posX -= 1;
-}
@@ -21,20 +21,17 @@ limitations under the License.
 /**
  * @class Coin
  * @inherit MovableElement
- * @details Provide a specific moving behaviour
+ * @details Provide the coin type
  *
  * @author Arthur
- * @date 19/03/2016
+ * @date 19/03/2016 - 17/10/2026
  */
 class Coin: public MovableElement
 {
 public:
     //=== CTORs / DTORs
-    Coin(float x, float y, float w, float h, float mvX, float mvY);
-    ~Coin() override;
-
-    //=== METHODS
-    void move() override;
+    Coin(MovableElementStore* store, float x, float y, float w, float h, float mvX);
+    ~Coin();
 };
 
 #endif
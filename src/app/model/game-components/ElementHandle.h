@@ -0,0 +1,66 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef ELEMENT_HANDLE_H
+#define ELEMENT_HANDLE_H
+
+#include "app/model/enums/MovableElementType.h"
+
+/**
+ * @struct ElementHandle
+ * @details Stable reference to an element of a MovableElementStore.
+ * The generation allows to detect handles of removed elements
+ * whose slot has been given to a new element.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct ElementHandle
+{
+    unsigned int slot;
+    unsigned int generation;
+};
+
+inline bool operator==(const ElementHandle& a, const ElementHandle& b)
+{
+    return a.slot == b.slot && a.generation == b.generation;
+}
+
+inline bool operator!=(const ElementHandle& a, const ElementHandle& b)
+{
+    return !(a == b);
+}
+
+inline bool operator<(const ElementHandle& a, const ElementHandle& b)
+{
+    return a.slot < b.slot || (a.slot == b.slot && a.generation < b.generation);
+}
+
+/**
+ * @struct ElementRemoval
+ * @details Record of an element removed from a MovableElementStore,
+ * keeping what is needed to react to the removal once the element is gone.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct ElementRemoval
+{
+    ElementHandle handle;
+    MovableElementType type;
+    bool hasCollided;
+};
+
+#endif
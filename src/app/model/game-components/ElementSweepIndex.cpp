@@ -0,0 +1,186 @@
+#include "ElementSweepIndex.h"
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ *
+ * @param store the store holding indexed elements
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+ElementSweepIndex::ElementSweepIndex(const MovableElementStore* store) :
+        m_store{store}, m_maxWidth{0}
+{
+    m_sortedHandles.reserve(store->getCapacity());
+}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+ElementSweepIndex::~ElementSweepIndex() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::size_t ElementSweepIndex::getSize() const { return m_sortedHandles.size(); }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Index a new element
+ * @details New elements usually appear on the right side of the field,
+ * which makes the insertion happen at the end of the index
+ *
+ * @param handle the element handle
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ElementSweepIndex::insert(const ElementHandle& handle)
+{
+    const float posX = getPosX(handle);
+    auto position = m_sortedHandles.end();
+
+    while (position != m_sortedHandles.begin() && getPosX(*(position - 1)) > posX) {
+        --position;
+    }
+
+    m_sortedHandles.insert(position, handle);
+    m_maxWidth = std::max(m_maxWidth, m_store->getWidth(m_store->getIndex(handle)));
+}
+
+/**
+ * @brief Remove an element from the index
+ * @warning It must be called before the element is removed from the store
+ *
+ * @param handle the element handle
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ElementSweepIndex::remove(const ElementHandle& handle)
+{
+    auto it = lowerBound(getPosX(handle));
+
+    while (it != m_sortedHandles.end() && *it != handle) {
+        ++it;
+    }
+
+    if (it != m_sortedHandles.end()) {
+        m_sortedHandles.erase(it);
+    }
+}
+
+/**
+ * @brief Remove all elements from the index
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ElementSweepIndex::clear()
+{
+    m_sortedHandles.clear();
+    m_maxWidth = 0;
+}
+
+/**
+ * @brief Find elements whose horizontal extent may overlap a range
+ * @details Candidates are appended to the result, an exact test must still be done
+ *
+ * @param minX the range left bound
+ * @param maxX the range right bound
+ * @param result the container receiving candidates store indexes
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ElementSweepIndex::query(float minX, float maxX, std::vector<std::size_t>& result) const
+{
+    auto it = lowerBound(minX - m_maxWidth);
+
+    while (it != m_sortedHandles.end() && getPosX(*it) <= maxX) {
+        result.push_back(m_store->getIndex(*it));
+        ++it;
+    }
+}
+
+/**
+ * @brief Save the indexed elements to a snapshot
+ *
+ * @param snapshot the snapshot to write to
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ElementSweepIndex::saveSnapshot(GameSnapshot& snapshot) const
+{
+    snapshot.write(m_maxWidth);
+    snapshot.writeArray(m_sortedHandles);
+}
+
+/**
+ * @brief Restore the indexed elements from a snapshot
+ * @warning The store must be restored from the same snapshot first
+ *
+ * @param snapshot the snapshot to read from
+ * @return true if the snapshot held an index of elements of the store
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool ElementSweepIndex::restoreSnapshot(GameSnapshot& snapshot)
+{
+    if (!snapshot.read(m_maxWidth) || !snapshot.readArray(m_sortedHandles, m_store->getCapacity())) {
+        return false;
+    }
+
+    for (const ElementHandle& handle : m_sortedHandles) {
+        if (!m_store->isAlive(handle)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Get the current x-position of an indexed element
+ *
+ * @param handle the element handle
+ * @return the element x-position
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+float ElementSweepIndex::getPosX(const ElementHandle& handle) const
+{
+    return m_store->getPosX(m_store->getIndex(handle));
+}
+
+/**
+ * @brief Find the first indexed element whose x-position isn't lower than a value
+ *
+ * @param x the searched x-position
+ * @return an iterator on the first matching element
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::vector<ElementHandle>::const_iterator ElementSweepIndex::lowerBound(float x) const
+{
+    return std::lower_bound(m_sortedHandles.begin(), m_sortedHandles.end(), x,
+                            [this](const ElementHandle& handle, float value) { return getPosX(handle) < value; });
+}
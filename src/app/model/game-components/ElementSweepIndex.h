@@ -0,0 +1,62 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef ELEMENT_SWEEP_INDEX_H
+#define ELEMENT_SWEEP_INDEX_H
+
+#include <algorithm>
+#include <vector>
+#include "MovableElementStore.h"
+
+/**
+ * @class ElementSweepIndex
+ * @details Broad phase index keeping field elements sorted by x-position,
+ * so that spatial queries only touch elements near the requested range.
+ * All indexed elements scroll at the same speed, so their order never changes
+ * while they move: the index is only updated on insertions and removals.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class ElementSweepIndex
+{
+public:
+    //=== CTORs / DTORs
+    explicit ElementSweepIndex(const MovableElementStore* store);
+    ~ElementSweepIndex();
+
+    //=== GETTERS
+    std::size_t getSize() const;
+
+    //=== METHODS
+    void insert(const ElementHandle& handle);
+    void remove(const ElementHandle& handle);
+    void clear();
+    void query(float minX, float maxX, std::vector<std::size_t>& result) const;
+    void saveSnapshot(GameSnapshot& snapshot) const;
+    bool restoreSnapshot(GameSnapshot& snapshot);
+
+private:
+    //=== ATTRIBUTES
+    const MovableElementStore* m_store;
+    std::vector<ElementHandle> m_sortedHandles;
+    float m_maxWidth;
+
+    //=== PRIVATE METHODS
+    float getPosX(const ElementHandle& handle) const;
+    std::vector<ElementHandle>::const_iterator lowerBound(float x) const;
+};
+
+#endif
@@ -1,26 +1,31 @@
 #include "Enemy.h"
 
+constexpr int Enemy::STANDARD_ENEMY_SIZE;
+constexpr int Enemy::TOTEM_ENEMY_WIDTH;
+constexpr int Enemy::TOTEM_ENEMY_HEIGHT;
+constexpr int Enemy::BLOCK_ENEMY_SIZE;
+
 //------------------------------------------------
 //          CONSTRUCTOR / DESTRUCTOR
 //------------------------------------------------
 
 /**
  * @brief Constructor
+ * @details The enemy size follows its type
  *
+ * @param store the store to add the element to
  * @param x the x position
  * @param y the y position
- * @param w the width
- * @param h the height
  * @param mvX the x moving direction
- * @param mvY the y moving direction
+ * @param type the enemy type
  *
  * @author Arthur
- * @date 13/03/2016
+ * @date 13/03/2016 - 17/10/2026
  */
-Enemy::Enemy(float x, float y, float w, float h, float mvX, float mvY) :
-        MovableElement(x, y, w, h, mvX, mvY)
+Enemy::Enemy(MovableElementStore* store, float x, float y, float mvX, const MovableElementType& type) :
+        MovableElement(store, x, y, getTypeWidth(type), getTypeHeight(type), mvX)
 {
-    chooseEnemyType();
+    m_store->setType(getIndex(), type);
 }
 
 /**
@@ -36,41 +41,67 @@ Enemy::~Enemy() = default;
 //------------------------------------------------
 
 /**
- * @brief Execute the move routine
+ * @brief Select an enemy type following probabilities
+ * @details Here are the probabilities: \n
+ *    1-55 : STANDARD  ~55% \n
+ *   56-80 : TOTEM     ~25% \n
+ *  81-100 : BLOCK     ~20%
+ *
+ * @param randomGenerator the game's random generator
+ * @return the chosen enemy type
  *
  * @author Arthur
- * @date 13/03/2016 - 11/07/2019
+ * @date 13/03/2016 - 17/10/2026
  */
-void Enemy::move()
+MovableElementType Enemy::chooseEnemyType(RandomGenerator& randomGenerator)
 {
-    m_posX -= 1;
+    int result = randomGenerator.getUniformRandomNumber(1, 100);
+
+    if (result <= 55) {
+        return STANDARD_ENEMY;
+    } else if (result <= 80) {
+        return TOTEM_ENEMY;
+    } else {
+        return BLOCK_ENEMY;
+    }
 }
 
 /**
- * @brief Select the enemy type following probabilities
- * @details Here are the probabilities: \n
- *    1-55 : STANDARD  ~55% \n
- *   56-80 : TOTEM     ~25% \n
- *  81-100 : BLOCK     ~20%
+ * @brief Get the width of enemies of a type
+ *
+ * @param type the enemy type
+ * @return the enemy width
  *
  * @author Arthur
- * @date 13/03/2016 - 13/01/2019
+ * @date 17/10/2026
  */
-void Enemy::chooseEnemyType()
+int Enemy::getTypeWidth(const MovableElementType& type)
 {
-    int result = RandomUtils::getUniformRandomNumber(1, 100);
+    if (type == TOTEM_ENEMY) {
+        return TOTEM_ENEMY_WIDTH;
+    } else if (type == BLOCK_ENEMY) {
+        return BLOCK_ENEMY_SIZE;
+    } else {
+        return STANDARD_ENEMY_SIZE;
+    }
+}
 
-    if (result <= 55) {
-        m_elementType = STANDARD_ENEMY;
-        m_width = STANDARD_ENEMY_SIZE;
-        m_height = STANDARD_ENEMY_SIZE;
-    } else if (result <= 80) {
-        m_elementType = TOTEM_ENEMY;
-        m_width = TOTEM_ENEMY_WIDTH;
-        m_height = TOTEM_ENEMY_HEIGHT;
+/**
+ * @brief Get the height of enemies of a type
+ *
+ * @param type the enemy type
+ * @return the enemy height
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+int Enemy::getTypeHeight(const MovableElementType& type)
+{
+    if (type == TOTEM_ENEMY) {
+        return TOTEM_ENEMY_HEIGHT;
+    } else if (type == BLOCK_ENEMY) {
+        return BLOCK_ENEMY_SIZE;
     } else {
-        m_elementType = BLOCK_ENEMY;
-        m_width = BLOCK_ENEMY_SIZE;
-        m_height = BLOCK_ENEMY_SIZE;
+        return STANDARD_ENEMY_SIZE;
     }
 }
@@ -21,27 +21,29 @@ limitations under the License.
 /**
  * @class Enemy
  * @inherit MovableElement
- * @details Provide a specific moving behaviour and enemy type
+ * @details Provide a specific enemy type,
+ * each type having its own size
  *
  * @author Arthur
- * @date 13/03/2016 - 13/01/2019
+ * @date 13/03/2016 - 17/10/2026
  */
 class Enemy: public MovableElement
 {
 public:
     //=== CTORs / DTORs
-    Enemy(float x, float y, float w, float h, float mvX, float mvY);
-    ~Enemy() override;
+    Enemy(MovableElementStore* store, float x, float y, float mvX, const MovableElementType& type);
+    ~Enemy();
 
     //=== METHODS
-    void move() override;
-    void chooseEnemyType();
+    static MovableElementType chooseEnemyType(RandomGenerator& randomGenerator);
+    static int getTypeWidth(const MovableElementType& type);
+    static int getTypeHeight(const MovableElementType& type);
 
 private:
-    const int STANDARD_ENEMY_SIZE = 30;
-    const int TOTEM_ENEMY_WIDTH = 30;
-    const int TOTEM_ENEMY_HEIGHT = 90;
-    const int BLOCK_ENEMY_SIZE = 50;
+    static constexpr int STANDARD_ENEMY_SIZE = 30;
+    static constexpr int TOTEM_ENEMY_WIDTH = 30;
+    static constexpr int TOTEM_ENEMY_HEIGHT = 90;
+    static constexpr int BLOCK_ENEMY_SIZE = 50;
 };
 
 #endif
\ No newline at end of file
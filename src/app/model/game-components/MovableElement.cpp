@@ -5,21 +5,33 @@
 //------------------------------------------------
 
 /**
- * @brief Constructor
+ * @brief Constructor of a view over an existing element
  *
+ * @param store the store holding the element
+ * @param handle the element handle
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+MovableElement::MovableElement(MovableElementStore* store, const ElementHandle& handle) :
+        m_store{store}, m_handle(handle)
+{}
+
+/**
+ * @brief Constructor adding a new element to the store
+ *
+ * @param store the store to add the element to
  * @param x the x position
  * @param y the y position
  * @param w the width
  * @param h the height
  * @param mvX the x moving direction
- * @param mvY the y moving direction
  *
  * @author Arthur, Florian
- * @date 23/02/2016 - 09/04/2016
+ * @date 23/02/2016 - 17/10/2026
  */
-MovableElement::MovableElement(float x, float y, float w, float h, float mvX, float mvY) :
-        m_posX{x}, m_posY{y}, m_width{w}, m_height{h}, m_moveX{mvX}, m_moveY{mvY},
-        m_isColliding{false}, m_elementType{UNDEFINED}
+MovableElement::MovableElement(MovableElementStore* store, float x, float y, float w, float h, float mvX) :
+        m_store{store}, m_handle(store->create(x, y, w, h, mvX, UNDEFINED))
 {}
 
 
@@ -35,12 +47,46 @@ MovableElement::~MovableElement() = default;
 //          GETTERS
 //------------------------------------------------
 
-float MovableElement::getPosX()  const { return m_posX;  }
-float MovableElement::getPosY()  const { return m_posY;  }
-float MovableElement::getWidth() const { return m_width; }
-float MovableElement::getHeight()const { return m_height; }
-MovableElementType MovableElement::getType() const { return m_elementType; }
-bool MovableElement::isColliding() const { return m_isColliding; }
+const ElementHandle& MovableElement::getHandle() const { return m_handle; }
+std::size_t MovableElement::getIndex() const { return m_store->getIndex(m_handle); }
+float MovableElement::getPosX()  const { return m_store->getPosX(getIndex());  }
+float MovableElement::getPosY()  const { return m_store->getPosY(getIndex());  }
+float MovableElement::getWidth() const { return m_store->getWidth(getIndex()); }
+float MovableElement::getHeight()const { return m_store->getHeight(getIndex()); }
+MovableElementType MovableElement::getType() const { return m_store->getType(getIndex()); }
+bool MovableElement::isColliding() const { return m_store->isColliding(getIndex()); }
+
+/**
+ * @brief Get the x-position blended between the two last simulation steps
+ *
+ * @param alpha the blending factor, 0 being the previous step and 1 the current one
+ * @return the interpolated x-position
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+float MovableElement::getInterpolatedPosX(float alpha) const
+{
+    const std::size_t index = getIndex();
+    const float previousPosX = m_store->getPreviousPosX(index);
+    return previousPosX + (m_store->getPosX(index) - previousPosX) * alpha;
+}
+
+/**
+ * @brief Get the y-position blended between the two last simulation steps
+ *
+ * @param alpha the blending factor, 0 being the previous step and 1 the current one
+ * @return the interpolated y-position
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+float MovableElement::getInterpolatedPosY(float alpha) const
+{
+    const std::size_t index = getIndex();
+    const float previousPosY = m_store->getPreviousPosY(index);
+    return previousPosY + (m_store->getPosY(index) - previousPosY) * alpha;
+}
 
 //------------------------------------------------
 //          METHODS
@@ -54,14 +100,11 @@ bool MovableElement::isColliding() const { return m_isColliding; }
  * @return a boolean indicating if position is in element
  *
  * @author Arthur
- * @date 08/03/2016 - 09/04/2016
+ * @date 08/03/2016 - 17/10/2026
  */
 bool MovableElement::contains(float x, float y) const
 {
-    float maxX = m_posX + m_width;
-    float maxY = m_posY + m_height;
-
-    return (x >= m_posX) && (x < maxX) && (y >= m_posY) && (y < maxY);
+    return m_store->contains(getIndex(), x, y);
 }
 
 /**
@@ -69,32 +112,13 @@ bool MovableElement::contains(float x, float y) const
  * @note Element's origin corresponds to left-bottom point
  * @warning This function must be called by the element which is set to be deleted
  *
- * @param other the other element
+ * @param other the other element, from the same store
  * @return a boolean indicating if elements are colliding
  *
  * @author Arthur
- * @date 02/04/2016 - 11/07/2019
+ * @date 02/04/2016 - 17/10/2026
  */
 bool MovableElement::collide(const MovableElement& other)
 {
-    if (!m_isColliding) {
-        float left_a, left_b;
-        float right_a, right_b;
-        float top_a, top_b;
-        float bottom_a, bottom_b;
-
-        left_a = m_posX;
-        right_a = m_posX + m_width;
-        top_a = m_posY - m_height;
-        bottom_a = m_posY;
-
-        left_b = other.m_posX;
-        right_b = other.m_posX + other.m_width;
-        top_b = other.m_posY - other.m_height;
-        bottom_b = other.m_posY;
-
-        m_isColliding = bottom_a >= top_b && top_a <= bottom_b && right_a >= left_b && left_a <= right_b;
-    }
-
-    return m_isColliding;
+    return m_store->collide(getIndex(), other.getIndex());
 }
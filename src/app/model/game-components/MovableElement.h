@@ -16,48 +16,49 @@ limitations under the License.
 #ifndef MOVABLE_ELEMENT_H
 #define MOVABLE_ELEMENT_H
 
-#include "app/model/utils/RandomUtils.h"
+#include "app/model/utils/RandomGenerator.h"
 #include "app/model/enums/MovableElementType.h"
+#include "MovableElementStore.h"
 
 /**
  * @class MovableElement
- * @note Abstract class
- * @details Provide common attributes and methods
- * to inherited classes
+ * @details Lightweight view over an element of a MovableElementStore,
+ * providing common attributes and methods to inherited classes.
+ * A view doesn't own its element: destroying it leaves the element in the store.
  *
  * @author Arthur, Florian
- * @date 23/02/2016 - 11/07/2019
+ * @date 23/02/2016 - 17/10/2026
  */
 class MovableElement
 {
 public:
     //=== CTORs / DTORs
-    MovableElement(float posX, float posY, float w, float h, float mvX, float mvY);
-    virtual ~MovableElement();
+    MovableElement(MovableElementStore* store, const ElementHandle& handle);
+    MovableElement(MovableElementStore* store, float posX, float posY, float w, float h, float mvX);
+    ~MovableElement();
 
     //=== METHODS
-    virtual void move() = 0;
     bool contains(float x, float y) const;
     bool collide(const MovableElement& other);
 
     //=== GETTERS
+    const ElementHandle& getHandle() const;
     float getPosX() const;
     float getPosY() const;
     float getWidth() const;
     float getHeight() const;
+    float getInterpolatedPosX(float alpha) const;
+    float getInterpolatedPosY(float alpha) const;
     bool isColliding() const;
-    virtual MovableElementType getType() const;
+    MovableElementType getType() const;
 
 protected:
+    //=== METHODS
+    std::size_t getIndex() const;
+
     //=== ATTRIBUTES
-    float m_posX;
-    float m_posY;
-    float m_width;
-    float m_height;
-    float m_moveX;
-    float m_moveY;
-    bool m_isColliding;
-    MovableElementType m_elementType;
+    MovableElementStore* m_store;
+    ElementHandle m_handle;
 };
 
 #endif
@@ -0,0 +1,415 @@
+#include "MovableElementStore.h"
+
+constexpr unsigned char MovableElementStore::COLLIDING_FLAG;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ * @details All memory is allocated here and all slots are put in the pool
+ *
+ * @param capacity the maximum number of elements
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+MovableElementStore::MovableElementStore(std::size_t capacity) :
+        m_capacity{capacity}, m_slotToIndex(capacity, 0), m_slotGeneration(capacity, 0)
+{
+    m_posX.reserve(capacity);
+    m_posY.reserve(capacity);
+    m_previousPosX.reserve(capacity);
+    m_previousPosY.reserve(capacity);
+    m_width.reserve(capacity);
+    m_height.reserve(capacity);
+    m_moveX.reserve(capacity);
+    m_type.reserve(capacity);
+    m_flags.reserve(capacity);
+    m_indexToSlot.reserve(capacity);
+    m_freeSlots.reserve(capacity);
+
+    for (std::size_t slot = capacity; slot > 0; slot--) {
+        m_freeSlots.push_back(static_cast<unsigned int>(slot - 1));
+    }
+}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+MovableElementStore::~MovableElementStore() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::size_t MovableElementStore::getSize() const { return m_posX.size(); }
+std::size_t MovableElementStore::getCapacity() const { return m_capacity; }
+std::size_t MovableElementStore::getPooledCount() const { return m_freeSlots.size(); }
+bool MovableElementStore::isFull() const { return m_freeSlots.empty(); }
+std::size_t MovableElementStore::getIndex(const ElementHandle& handle) const { return m_slotToIndex[handle.slot]; }
+ElementHandle MovableElementStore::getHandle(std::size_t index) const
+{
+    return ElementHandle{m_indexToSlot[index], m_slotGeneration[m_indexToSlot[index]]};
+}
+float MovableElementStore::getPosX(std::size_t index) const { return m_posX[index]; }
+float MovableElementStore::getPosY(std::size_t index) const { return m_posY[index]; }
+float MovableElementStore::getPreviousPosX(std::size_t index) const { return m_previousPosX[index]; }
+float MovableElementStore::getPreviousPosY(std::size_t index) const { return m_previousPosY[index]; }
+float MovableElementStore::getWidth(std::size_t index) const { return m_width[index]; }
+float MovableElementStore::getHeight(std::size_t index) const { return m_height[index]; }
+float MovableElementStore::getMoveX(std::size_t index) const { return m_moveX[index]; }
+MovableElementType MovableElementStore::getType(std::size_t index) const { return m_type[index]; }
+bool MovableElementStore::isColliding(std::size_t index) const { return (m_flags[index] & COLLIDING_FLAG) != 0; }
+
+/**
+ * @brief Check if a handle still references an element of the store
+ *
+ * @param handle the element handle
+ * @return a boolean indicating if the element hasn't been removed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool MovableElementStore::isAlive(const ElementHandle& handle) const
+{
+    return handle.slot < m_slotGeneration.size()
+           && m_slotGeneration[handle.slot] == handle.generation
+           && m_slotToIndex[handle.slot] < m_posX.size();
+}
+
+//------------------------------------------------
+//          SETTERS
+//------------------------------------------------
+
+void MovableElementStore::setType(std::size_t index, MovableElementType type) { m_type[index] = type; }
+void MovableElementStore::setColliding(std::size_t index) { m_flags[index] |= COLLIDING_FLAG; }
+
+void MovableElementStore::setPosition(std::size_t index, float x, float y)
+{
+    m_posX[index] = x;
+    m_posY[index] = y;
+}
+
+void MovableElementStore::setSize(std::size_t index, float w, float h)
+{
+    m_width[index] = w;
+    m_height[index] = h;
+}
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Add a new element at the end of the store, recycling a pooled slot
+ * @warning The store must not be full
+ *
+ * @param x the x position
+ * @param y the y position
+ * @param w the width
+ * @param h the height
+ * @param mvX the x moving direction
+ * @param type the element type
+ * @return the handle of the new element
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+ElementHandle MovableElementStore::create(float x, float y, float w, float h, float mvX, MovableElementType type)
+{
+    const unsigned int slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+
+    m_slotToIndex[slot] = m_posX.size();
+
+    m_posX.push_back(x);
+    m_posY.push_back(y);
+    m_previousPosX.push_back(x);
+    m_previousPosY.push_back(y);
+    m_width.push_back(w);
+    m_height.push_back(h);
+    m_moveX.push_back(mvX);
+    m_type.push_back(type);
+    m_flags.push_back(0);
+    m_indexToSlot.push_back(slot);
+
+    return ElementHandle{slot, m_slotGeneration[slot]};
+}
+
+/**
+ * @brief Remove an element from the store
+ * @details The last element takes the place of the removed one to keep arrays packed,
+ * the handle slot is then given back to the pool for a future element
+ *
+ * @param handle the handle of the element to remove
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MovableElementStore::destroy(const ElementHandle& handle)
+{
+    if (!isAlive(handle)) {
+        return;
+    }
+
+    const std::size_t index = m_slotToIndex[handle.slot];
+    const std::size_t last = m_posX.size() - 1;
+
+    if (index != last) {
+        m_posX[index] = m_posX[last];
+        m_posY[index] = m_posY[last];
+        m_previousPosX[index] = m_previousPosX[last];
+        m_previousPosY[index] = m_previousPosY[last];
+        m_width[index] = m_width[last];
+        m_height[index] = m_height[last];
+        m_moveX[index] = m_moveX[last];
+        m_type[index] = m_type[last];
+        m_flags[index] = m_flags[last];
+        m_indexToSlot[index] = m_indexToSlot[last];
+        m_slotToIndex[m_indexToSlot[index]] = index;
+    }
+
+    m_posX.pop_back();
+    m_posY.pop_back();
+    m_previousPosX.pop_back();
+    m_previousPosY.pop_back();
+    m_width.pop_back();
+    m_height.pop_back();
+    m_moveX.pop_back();
+    m_type.pop_back();
+    m_flags.pop_back();
+    m_indexToSlot.pop_back();
+
+    m_slotGeneration[handle.slot]++;
+    m_freeSlots.push_back(handle.slot);
+}
+
+/**
+ * @brief Remove all elements from the store
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MovableElementStore::clear()
+{
+    while (!m_indexToSlot.empty()) {
+        destroy(getHandle(m_indexToSlot.size() - 1));
+    }
+}
+
+/**
+ * @brief Keep all current positions as previous simulation step positions
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MovableElementStore::savePreviousPositions()
+{
+    m_previousPosX = m_posX;
+    m_previousPosY = m_posY;
+}
+
+/**
+ * @brief Advance all elements by a distance following their x moving direction
+ *
+ * @param distance the distance travelled by the field during the step
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MovableElementStore::advance(float distance)
+{
+    const std::size_t size = m_posX.size();
+
+    for (std::size_t i = 0; i < size; i++) {
+        m_posX[i] += m_moveX[i] * distance;
+    }
+}
+
+/**
+ * @brief Check if a position belongs to an element
+ * @note Element's edges belong to the element
+ *
+ * @param index the element index
+ * @param x the other element x-position
+ * @param y the other element y-position
+ * @return a boolean indicating if position is in element
+ *
+ * @author Arthur
+ * @date 08/03/2016 - 17/10/2026
+ */
+bool MovableElementStore::contains(std::size_t index, float x, float y) const
+{
+    return CollisionUtils::overlap(x, y, x, y, m_posX[index], m_posY[index] - m_height[index],
+                                   m_posX[index] + m_width[index], m_posY[index]);
+}
+
+/**
+ * @brief Determine if elements are colliding
+ * @details The test is swept along the x-axis: the element is checked all along
+ * its relative horizontal path since the previous simulation step,
+ * so that fast elements can't pass through the other one in a single step
+ * @note Element's origin corresponds to left-bottom point
+ * @warning This function must be called for the element which is set to be deleted
+ *
+ * @param index the element index
+ * @param otherIndex the other element index
+ * @return a boolean indicating if elements are colliding
+ *
+ * @author Arthur
+ * @date 02/04/2016 - 17/10/2026
+ */
+bool MovableElementStore::collide(std::size_t index, std::size_t otherIndex)
+{
+    if (!isColliding(index)) {
+        float previousRelativeX = m_previousPosX[index] - m_previousPosX[otherIndex];
+        float currentRelativeX = m_posX[index] - m_posX[otherIndex];
+
+        if (CollisionUtils::overlap(std::min(previousRelativeX, currentRelativeX),
+                                    m_posY[index] - m_height[index],
+                                    std::max(previousRelativeX, currentRelativeX) + m_width[index],
+                                    m_posY[index],
+                                    0,
+                                    m_posY[otherIndex] - m_height[otherIndex],
+                                    m_width[otherIndex],
+                                    m_posY[otherIndex])) {
+            setColliding(index);
+        }
+    }
+
+    return isColliding(index);
+}
+
+/**
+ * @brief Fill a batch with bounding boxes of several elements
+ *
+ * @param indexes the elements indexes
+ * @param batch the batch to fill, its k-th box being the one of the k-th element
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MovableElementStore::fillBoundingBoxes(const std::vector<std::size_t>& indexes, BoundingBoxBatch& batch) const
+{
+    batch.resize(indexes.size());
+
+    for (std::size_t k = 0; k < indexes.size(); k++) {
+        const std::size_t i = indexes[k];
+        batch.setBox(k, m_posX[i], m_posY[i] - m_height[i], m_posX[i] + m_width[i], m_posY[i]);
+    }
+}
+
+/**
+ * @brief Save all elements and handles data to a snapshot
+ *
+ * @param snapshot the snapshot to write to
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MovableElementStore::saveSnapshot(GameSnapshot& snapshot) const
+{
+    snapshot.write(static_cast<std::uint64_t>(m_capacity));
+    snapshot.writeArray(m_posX);
+    snapshot.writeArray(m_posY);
+    snapshot.writeArray(m_previousPosX);
+    snapshot.writeArray(m_previousPosY);
+    snapshot.writeArray(m_width);
+    snapshot.writeArray(m_height);
+    snapshot.writeArray(m_moveX);
+    snapshot.writeArray(m_type);
+    snapshot.writeArray(m_flags);
+    snapshot.writeArray(m_indexToSlot);
+    snapshot.writeArray(m_slotToIndex);
+    snapshot.writeArray(m_slotGeneration);
+    snapshot.writeArray(m_freeSlots);
+}
+
+/**
+ * @brief Restore all elements and handles data from a snapshot
+ * @details Arrays keep their memory, which is big enough for a store of the same capacity.
+ * If the snapshot is invalid, the store is left inconsistent and must be restored again
+ *
+ * @param snapshot the snapshot to read from
+ * @return true if the snapshot held a consistent store of the same capacity
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool MovableElementStore::restoreSnapshot(GameSnapshot& snapshot)
+{
+    std::uint64_t capacity;
+
+    return snapshot.read(capacity) && capacity == m_capacity
+           && snapshot.readArray(m_posX, m_capacity)
+           && snapshot.readArray(m_posY, m_capacity)
+           && snapshot.readArray(m_previousPosX, m_capacity)
+           && snapshot.readArray(m_previousPosY, m_capacity)
+           && snapshot.readArray(m_width, m_capacity)
+           && snapshot.readArray(m_height, m_capacity)
+           && snapshot.readArray(m_moveX, m_capacity)
+           && snapshot.readArray(m_type, m_capacity)
+           && snapshot.readArray(m_flags, m_capacity)
+           && snapshot.readArray(m_indexToSlot, m_capacity)
+           && snapshot.readArray(m_slotToIndex, m_capacity)
+           && snapshot.readArray(m_slotGeneration, m_capacity)
+           && snapshot.readArray(m_freeSlots, m_capacity)
+           && validateRestoredData();
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Check that restored arrays describe a valid store
+ * @details Elements arrays must have the same size, each element using its own slot,
+ * and free slots must be all other slots, each listed once.
+ * Free slots indexes being meaningless, they are overwritten to mark listed slots
+ *
+ * @return true if the store can be used
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool MovableElementStore::validateRestoredData()
+{
+    const std::size_t size = m_posX.size();
+
+    if (m_posY.size() != size || m_previousPosX.size() != size || m_previousPosY.size() != size
+            || m_width.size() != size || m_height.size() != size || m_moveX.size() != size
+            || m_type.size() != size || m_flags.size() != size || m_indexToSlot.size() != size
+            || m_slotToIndex.size() != m_capacity || m_slotGeneration.size() != m_capacity
+            || m_freeSlots.size() != m_capacity - size) {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < size; index++) {
+        const unsigned int slot = m_indexToSlot[index];
+        if (slot >= m_capacity || m_slotToIndex[slot] != index
+                || static_cast<unsigned int>(m_type[index]) > UNDEFINED) {
+            return false;
+        }
+    }
+
+    for (unsigned int slot : m_freeSlots) {
+        if (slot >= m_capacity || (m_slotToIndex[slot] < size && m_indexToSlot[m_slotToIndex[slot]] == slot)) {
+            return false;
+        }
+        m_slotToIndex[slot] = m_capacity;
+    }
+
+    for (unsigned int slot : m_freeSlots) {
+        if (m_slotToIndex[slot] != m_capacity) {
+            return false;
+        }
+        m_slotToIndex[slot] = m_capacity + 1;
+    }
+
+    return true;
+}
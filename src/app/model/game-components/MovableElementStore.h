@@ -0,0 +1,116 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MOVABLE_ELEMENT_STORE_H
+#define MOVABLE_ELEMENT_STORE_H
+
+#include <algorithm>
+#include <vector>
+#include "app/model/enums/MovableElementType.h"
+#include "app/model/snapshot/GameSnapshot.h"
+#include "app/model/utils/CollisionUtils.h"
+#include "ElementHandle.h"
+
+/**
+ * @class MovableElementStore
+ * @details Hold all movable elements data in a structure of arrays,
+ * so that per-step passes are linear scans over contiguous memory.
+ * Elements are kept packed: a removal moves the last element in the freed place.
+ * ElementHandle gives a stable access to an element whatever its current index.
+ *
+ * The store has a fixed capacity allocated once: removed elements slots
+ * are pooled and recycled by new elements, so the store never grows.
+ * As all its data is plain arrays, the whole store, handles included,
+ * can be saved to a snapshot and restored without allocation.
+ *
+ * Element's origin corresponds to left-bottom point, overlap tests follow
+ * CollisionUtils convention.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class MovableElementStore
+{
+public:
+    //=== CTORs / DTORs
+    explicit MovableElementStore(std::size_t capacity);
+    ~MovableElementStore();
+
+    //=== GETTERS
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+    std::size_t getPooledCount() const;
+    bool isFull() const;
+    bool isAlive(const ElementHandle& handle) const;
+    std::size_t getIndex(const ElementHandle& handle) const;
+    ElementHandle getHandle(std::size_t index) const;
+    float getPosX(std::size_t index) const;
+    float getPosY(std::size_t index) const;
+    float getPreviousPosX(std::size_t index) const;
+    float getPreviousPosY(std::size_t index) const;
+    float getWidth(std::size_t index) const;
+    float getHeight(std::size_t index) const;
+    float getMoveX(std::size_t index) const;
+    MovableElementType getType(std::size_t index) const;
+    bool isColliding(std::size_t index) const;
+
+    //=== SETTERS
+    void setPosition(std::size_t index, float x, float y);
+    void setSize(std::size_t index, float w, float h);
+    void setType(std::size_t index, MovableElementType type);
+    void setColliding(std::size_t index);
+
+    //=== METHODS
+    ElementHandle create(float x, float y, float w, float h, float mvX, MovableElementType type);
+    void destroy(const ElementHandle& handle);
+    void clear();
+    void savePreviousPositions();
+    void advance(float distance);
+    bool contains(std::size_t index, float x, float y) const;
+    bool collide(std::size_t index, std::size_t otherIndex);
+    void fillBoundingBoxes(const std::vector<std::size_t>& indexes, BoundingBoxBatch& batch) const;
+    void saveSnapshot(GameSnapshot& snapshot) const;
+    bool restoreSnapshot(GameSnapshot& snapshot);
+
+private:
+    //=== ATTRIBUTES
+
+    std::size_t m_capacity;
+
+    //Elements data, indexed by element index
+    std::vector<float> m_posX;
+    std::vector<float> m_posY;
+    std::vector<float> m_previousPosX;
+    std::vector<float> m_previousPosY;
+    std::vector<float> m_width;
+    std::vector<float> m_height;
+    std::vector<float> m_moveX;
+    std::vector<MovableElementType> m_type;
+    std::vector<unsigned char> m_flags;
+    std::vector<unsigned int> m_indexToSlot;
+
+    //Handles data, indexed by slot
+    std::vector<std::size_t> m_slotToIndex;
+    std::vector<unsigned int> m_slotGeneration;
+    std::vector<unsigned int> m_freeSlots;
+
+    //Constants
+    static constexpr unsigned char COLLIDING_FLAG = 1 << 0;
+
+    //=== PRIVATE METHODS
+    bool validateRestoredData();
+};
+
+#endif
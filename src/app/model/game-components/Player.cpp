@@ -8,26 +8,28 @@ constexpr int Player::MAX_ENERGY;
 
 /**
  * @brief Constructor
+ * @note The player is added to the store without moving direction, as it doesn't follow the field
  *
+ * @param store the store to add the player to
  * @param x the x position
  * @param y the y position
  * @param w the width
  * @param h the height
- * @param mvX the x moving direction
- * @param mvY the y moving direction
+ * @param mvX the x moving factor
  * @param floor the floor y position
  * @param fieldWidth the total field width
  * @param jumpLimit the jump limit in height
  *
  * @author Arthur, Florian
- * @date 22/02/2016 - 16/09/2018
+ * @date 22/02/2016 - 17/10/2026
  */
-Player::Player(float x, float y, float w, float h, float mvX, float mvY, int floor, int fieldWidth, int jumpLimit) :
-        MovableElement(x, y, w, h, mvX, mvY), m_state{NORMAL}, m_energy{MAX_ENERGY}, m_initialWidth{w}, m_initialHeight{h},
+Player::Player(MovableElementStore* store, float x, float y, float w, float h, float mvX, int floor, int fieldWidth,
+               int jumpLimit) :
+        MovableElement(store, x, y, w, h, 0), m_state{NORMAL}, m_energy{MAX_ENERGY}, m_initialWidth{w}, m_initialHeight{h},
         m_floorPosition{floor}, m_fieldWidth{fieldWidth}, m_jumpLimit{jumpLimit}, m_gravitation{INITIAL_GRAVITATION},
-        m_acceleration{INITIAL_ACCELERATION}, m_isJumping{false}, m_isFlying{false}, m_isDecelerating{false}
+        m_acceleration{INITIAL_ACCELERATION}, m_moveX{mvX}, m_isJumping{false}, m_isFlying{false}, m_isDecelerating{false}
 {
-    m_elementType = PLAYER;
+    m_store->setType(getIndex(), PLAYER);
     m_playerVector.first = 0;
     m_playerVector.second = 0;
 }
@@ -54,15 +56,22 @@ int Player::getLife() const { return m_energy; }
 
 /**
  * @brief Execute the move routine
+ * @note The player doesn't follow the field, it moves by its own physics
  *
  * @author Florian
- * @date  12/03/2016 - 16/09/2018
+ * @date  12/03/2016 - 17/10/2026
  */
 void Player::move()
 {
-    m_isFlying = m_width < m_floorPosition;
+    const std::size_t index = getIndex();
+    const float width = m_store->getWidth(index);
+    const float height = m_store->getHeight(index);
+    float posX = m_store->getPosX(index);
+    float posY = m_store->getPosY(index);
 
-    if (m_posY < m_jumpLimit) {
+    m_isFlying = width < m_floorPosition;
+
+    if (posY < m_jumpLimit) {
         m_isJumping = false;
     }
 
@@ -74,46 +83,48 @@ void Player::move()
         m_playerVector.first /= 1 + m_moveX / PLAYER_RATE;
     }
 
-    if (m_isJumping && m_posY >= m_floorPosition) {
+    if (m_isJumping && posY >= m_floorPosition) {
         m_playerVector.second = -m_acceleration * m_gravitation / PLAYER_RATE;
-        m_posY += m_playerVector.second / PLAYER_RATE;
+        posY += m_playerVector.second / PLAYER_RATE;
     }
 
     if (m_isFlying) {
         m_playerVector.second += m_gravitation / PLAYER_RATE;
-        m_posY += m_playerVector.second / PLAYER_RATE;
+        posY += m_playerVector.second / PLAYER_RATE;
     }
 
-    if (m_posY == m_floorPosition && m_isFlying) {
+    if (posY == m_floorPosition && m_isFlying) {
         m_isFlying = false;
         m_isJumping = false;
-        m_posY = m_floorPosition;
+        posY = m_floorPosition;
     }
-    if (m_posY > m_floorPosition) {
+    if (posY > m_floorPosition) {
         m_playerVector.second = 0;
-        m_posY = m_floorPosition;
+        posY = m_floorPosition;
     }
 
     //=== Update player position
 
-    if (m_posX + m_playerVector.first >= 0 && (m_posX + m_width + m_playerVector.first) <= m_fieldWidth) {
-        m_posX += m_playerVector.first;
-    } else if (m_posX + m_playerVector.first < 0) {
-        m_posX = 0;
+    if (posX + m_playerVector.first >= 0 && (posX + width + m_playerVector.first) <= m_fieldWidth) {
+        posX += m_playerVector.first;
+    } else if (posX + m_playerVector.first < 0) {
+        posX = 0;
     } else {
-        m_posX = m_fieldWidth - m_width;
+        posX = m_fieldWidth - width;
     }
 
-    if (m_posY - m_height <= 0) {
+    if (posY - height <= 0) {
         m_playerVector.second = 0;
     }
 
-    m_posY += m_playerVector.second;
+    posY += m_playerVector.second;
 
-    if (m_posY >= m_floorPosition + PRECISION) {
+    if (posY >= m_floorPosition + PRECISION) {
         m_playerVector.second = 0;
-        m_posY = m_floorPosition;
+        posY = m_floorPosition;
     }
+
+    m_store->setPosition(index, posX, posY);
 }
 
 /**
@@ -168,30 +179,26 @@ void Player::decelerate()
  *
  * @param state the player's new state
  *
- * @date  11/04/2016 - 05/09/2018
+ * @date  11/04/2016 - 17/10/2026
  */
 void Player::changeState(const PlayerState& state)
 {
     m_state = state;
 
     if (state == NORMAL) {
-        m_width = m_initialWidth;
-        m_height = m_initialHeight;
+        m_store->setSize(getIndex(), m_initialWidth, m_initialHeight);
         m_gravitation = INITIAL_GRAVITATION;
         m_acceleration = INITIAL_ACCELERATION;
     } else if (state == MEGA) {
-        m_width = m_initialWidth * 2;
-        m_height = m_initialHeight * 2;
+        m_store->setSize(getIndex(), m_initialWidth * 2, m_initialHeight * 2);
         m_gravitation = INITIAL_GRAVITATION;
         m_acceleration = INITIAL_ACCELERATION;
     } else if (state == FLYING) {
-        m_width = m_initialWidth;
-        m_height = m_initialHeight;
+        m_store->setSize(getIndex(), m_initialWidth, m_initialHeight);
         m_gravitation = FLYING_GRAVITATION;
         m_acceleration = FLYING_ACCELERATION;
     } else if (state == SHIELDED || state == HARD_SHIELDED) {
-        m_width = m_initialWidth;
-        m_height = m_initialHeight;
+        m_store->setSize(getIndex(), m_initialWidth, m_initialHeight);
         m_gravitation = INITIAL_GRAVITATION;
         m_acceleration = INITIAL_ACCELERATION;
     }
@@ -215,3 +222,53 @@ void Player::controlPlayerMovements(const MovingDirection& direction)
         m_playerVector.first += m_moveX * m_acceleration / PLAYER_RATE;
     }
 }
+
+/**
+ * @brief Save the player's state and physics to a snapshot
+ * @note Element data (position, size) are saved with the store
+ *
+ * @param snapshot the snapshot to write to
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Player::saveSnapshot(GameSnapshot& snapshot) const
+{
+    snapshot.write(m_handle);
+    snapshot.write(m_state);
+    snapshot.write(m_energy);
+    snapshot.write(m_gravitation);
+    snapshot.write(m_acceleration);
+    snapshot.write(m_moveX);
+    snapshot.write(m_isJumping);
+    snapshot.write(m_isFlying);
+    snapshot.write(m_isDecelerating);
+    snapshot.write(m_playerVector.first);
+    snapshot.write(m_playerVector.second);
+}
+
+/**
+ * @brief Restore the player's state and physics from a snapshot
+ *
+ * @param snapshot the snapshot to read from
+ * @return true if the snapshot held the state of this player element
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool Player::restoreSnapshot(GameSnapshot& snapshot)
+{
+    ElementHandle handle;
+
+    return snapshot.read(handle) && handle == m_handle
+           && snapshot.readEnum(m_state, NORMAL, HARD_SHIELDED)
+           && snapshot.read(m_energy)
+           && snapshot.read(m_gravitation)
+           && snapshot.read(m_acceleration)
+           && snapshot.read(m_moveX)
+           && snapshot.read(m_isJumping)
+           && snapshot.read(m_isFlying)
+           && snapshot.read(m_isDecelerating)
+           && snapshot.read(m_playerVector.first)
+           && snapshot.read(m_playerVector.second);
+}
@@ -29,27 +29,30 @@ limitations under the License.
  * @details Provide player's logic and behaviours
  *
  * @author Arthur, Florian
- * @date 22/02/2016 - 13/01/2019
+ * @date 22/02/2016 - 17/10/2026
  */
 class Player: public MovableElement
 {
 public:
     //=== CTORs / DTORs
-    Player(float x, float y, float w, float h, float mvX, float mvY, int floor, int fieldWidth, int jumpLimit);
-    ~Player() override;
+    Player(MovableElementStore* store, float x, float y, float w, float h, float mvX, int floor, int fieldWidth,
+           int jumpLimit);
+    ~Player();
 
     //=== GETTERS
     PlayerState getState() const;
     int getLife() const;
 
     //=== METHODS
-    void move() override;
+    void move();
     void takeDamages(int amount);
     void heal(int energy);
     void jump();
     void decelerate();
     void changeState(const PlayerState& state);
     void controlPlayerMovements(const MovingDirection& direction);
+    void saveSnapshot(GameSnapshot& snapshot) const;
+    bool restoreSnapshot(GameSnapshot& snapshot);
 
     //=== CONSTANTS
     static constexpr int MIN_ENERGY = 0;
@@ -65,6 +68,7 @@ private:
     int m_jumpLimit;
     float m_gravitation;
     float m_acceleration;
+    float m_moveX;
     bool m_isJumping;
     bool m_isFlying;
     bool m_isDecelerating;
@@ -0,0 +1,359 @@
+#include "LevelGenerator.h"
+
+constexpr std::uint32_t LevelGenerator::QUEUE_CAPACITY;
+constexpr std::uint32_t LevelGenerator::MAX_CHUNK_ENTRIES;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ * @details All memory is allocated here, no chunk being generated yet
+ *
+ * @param randomGenerator the game's random generator
+ * @param difficulty the game difficulty, reducing gaps between obstacles
+ * @param startPosition the field position where the level starts
+ * @param bonusHeight the height of bonuses above the floor
+ * @param maxSpeed the maximum game speed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LevelGenerator::LevelGenerator(RandomGenerator& randomGenerator, int difficulty, std::uint32_t startPosition,
+                               int bonusHeight, int maxSpeed) :
+        m_randomGenerator(randomGenerator), m_difficulty{std::max(difficulty, 1)}, m_bonusHeight{bonusHeight},
+        m_maxSpeed{maxSpeed}, m_entries(QUEUE_CAPACITY), m_head{0}, m_count{0}, m_chunkCount{0},
+        m_generatedLength{startPosition}, m_nextObstaclePosition{startPosition}, m_nextCoinPosition{startPosition},
+        m_nextBonusPosition{startPosition}, m_lastObstacle{0, 0, 0, 0}
+{
+    m_chunkEntries.reserve(MAX_CHUNK_ENTRIES);
+    m_blockers.reserve(MAX_CHUNK_ENTRIES + 1);
+}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LevelGenerator::~LevelGenerator() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::uint32_t LevelGenerator::getGeneratedLength() const { return m_generatedLength; }
+std::size_t LevelGenerator::getQueuedCount() const { return m_count; }
+std::uint32_t LevelGenerator::getChunkCount() const { return m_chunkCount; }
+std::size_t LevelGenerator::getCapacity() { return QUEUE_CAPACITY; }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Generate the next chunk of the level and queue its elements
+ * @details Obstacles gaps are scaled by the speed expected when the chunk shows up,
+ * other elements gaps by the current speed, so that the level density
+ * in time stays the same as the game speeds up
+ *
+ * @param speed the current game speed
+ * @return true if the chunk was generated, false if the queue is too full to hold it
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LevelGenerator::generateChunk(float speed)
+{
+    if (QUEUE_CAPACITY - m_count < MAX_CHUNK_ENTRIES) {
+        return false;
+    }
+
+    const int stepLength = std::max(1, static_cast<int>(std::ceil(speed)));
+    const int expectedSpeed = std::min(stepLength + SPEED_MARGIN, std::max(m_maxSpeed, stepLength));
+    const std::uint32_t chunkEnd = m_generatedLength + CHUNK_LENGTH;
+
+    //First elements are drawn once the game speed is known
+    if (m_chunkCount == 0) {
+        m_nextObstaclePosition += static_cast<std::uint32_t>(
+                m_randomGenerator.getUniformRandomNumber(FIRST_OBSTACLE_MIN_STEPS, FIRST_OBSTACLE_MAX_STEPS)
+                * stepLength);
+        m_nextBonusPosition += static_cast<std::uint32_t>(
+                m_randomGenerator.getUniformRandomNumber(FIRST_BONUS_MIN_STEPS, FIRST_BONUS_MAX_STEPS) * stepLength);
+    }
+
+    m_chunkEntries.clear();
+    placeObstacles(chunkEnd, expectedSpeed);
+    placeBonuses(chunkEnd, stepLength);
+    placeCoins(chunkEnd, stepLength);
+
+    std::stable_sort(m_chunkEntries.begin(), m_chunkEntries.end(),
+                     [](const LevelEntry& a, const LevelEntry& b) { return a.position < b.position; });
+
+    validateChunk(expectedSpeed);
+
+    for (const LevelEntry& entry : m_chunkEntries) {
+        m_entries[(m_head + m_count) % QUEUE_CAPACITY] = entry;
+        m_count++;
+    }
+
+    m_generatedLength = chunkEnd;
+    m_chunkCount++;
+    return true;
+}
+
+/**
+ * @brief Get the next queued element
+ *
+ * @param entry the entry to fill
+ * @return true if an element was queued
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LevelGenerator::peek(LevelEntry& entry) const
+{
+    if (m_count == 0) {
+        return false;
+    }
+
+    entry = m_entries[m_head];
+    return true;
+}
+
+/**
+ * @brief Remove the next queued element
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LevelGenerator::pop()
+{
+    if (m_count != 0) {
+        m_head = (m_head + 1) % QUEUE_CAPACITY;
+        m_count--;
+    }
+}
+
+/**
+ * @brief Save the queued elements and the generation progress to a snapshot
+ * @details The game's random generator is saved by the game
+ *
+ * @param snapshot the snapshot to write to
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LevelGenerator::saveSnapshot(GameSnapshot& snapshot) const
+{
+    snapshot.write(m_head);
+    snapshot.write(m_count);
+    snapshot.write(m_chunkCount);
+    snapshot.write(m_generatedLength);
+    snapshot.write(m_nextObstaclePosition);
+    snapshot.write(m_nextCoinPosition);
+    snapshot.write(m_nextBonusPosition);
+    snapshot.write(m_lastObstacle);
+    snapshot.writeArray(m_entries);
+}
+
+/**
+ * @brief Restore the queued elements and the generation progress from a snapshot
+ *
+ * @param snapshot the snapshot to read from
+ * @return true if the snapshot held a valid queue
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LevelGenerator::restoreSnapshot(GameSnapshot& snapshot)
+{
+    if (!snapshot.read(m_head)
+            || !snapshot.read(m_count)
+            || !snapshot.read(m_chunkCount)
+            || !snapshot.read(m_generatedLength)
+            || !snapshot.read(m_nextObstaclePosition)
+            || !snapshot.read(m_nextCoinPosition)
+            || !snapshot.read(m_nextBonusPosition)
+            || !snapshot.read(m_lastObstacle)
+            || !snapshot.readArray(m_entries, QUEUE_CAPACITY)
+            || m_entries.size() != QUEUE_CAPACITY || m_head >= QUEUE_CAPACITY || m_count > QUEUE_CAPACITY) {
+        return false;
+    }
+
+    for (const LevelEntry& entry : m_entries) {
+        if (entry.type > UNDEFINED) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Place the obstacles of a chunk
+ * @details The difficulty divides the random part of the gaps
+ *
+ * @param chunkEnd the field position where the chunk ends
+ * @param expectedSpeed the speed expected when the chunk shows up
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LevelGenerator::placeObstacles(std::uint32_t chunkEnd, int expectedSpeed)
+{
+    while (m_nextObstaclePosition < chunkEnd) {
+        const MovableElementType type = Enemy::chooseEnemyType(m_randomGenerator);
+        const int gapSteps = JUMP_STEPS + SAFETY_STEPS
+                + m_randomGenerator.getUniformRandomNumber(0, OBSTACLE_GAP_SPREAD_STEPS / m_difficulty);
+
+        m_chunkEntries.push_back(LevelEntry{m_nextObstaclePosition, 0, static_cast<std::uint8_t>(type)});
+        m_nextObstaclePosition += static_cast<std::uint32_t>(gapSteps * expectedSpeed);
+    }
+}
+
+/**
+ * @brief Place the bonuses of a chunk
+ *
+ * @param chunkEnd the field position where the chunk ends
+ * @param stepLength the distance scrolled by a step at the current speed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LevelGenerator::placeBonuses(std::uint32_t chunkEnd, int stepLength)
+{
+    while (m_nextBonusPosition < chunkEnd) {
+        const MovableElementType type = Bonus::chooseBonusType(m_randomGenerator);
+
+        m_chunkEntries.push_back(LevelEntry{m_nextBonusPosition, static_cast<std::uint16_t>(m_bonusHeight),
+                                            static_cast<std::uint8_t>(type)});
+        m_nextBonusPosition += static_cast<std::uint32_t>(
+                m_randomGenerator.getUniformRandomNumber(BONUS_GAP_MIN_STEPS, BONUS_GAP_MAX_STEPS) * stepLength);
+    }
+}
+
+/**
+ * @brief Place the coin patterns of a chunk
+ * @details Here are the patterns probabilities: \n
+ *    1-50 : single coin         ~50% \n
+ *   51-80 : row of coins        ~30% \n
+ *  81-100 : arc of coins        ~20% \n
+ * Coins going past the chunk end are left out, so that chunks never overlap
+ *
+ * @param chunkEnd the field position where the chunk ends
+ * @param stepLength the distance scrolled by a step at the current speed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LevelGenerator::placeCoins(std::uint32_t chunkEnd, int stepLength)
+{
+    while (m_nextCoinPosition < chunkEnd) {
+        const int pattern = m_randomGenerator.getUniformRandomNumber(1, 100);
+        const int height = m_randomGenerator.getUniformRandomNumber(0, COIN_MAX_HEIGHT);
+        const int length = pattern <= 50 ? 1 : (pattern <= 80 ? COIN_ROW_LENGTH : COIN_ARC_LENGTH);
+        const int arcWidth = (COIN_ARC_LENGTH - 1) * (COIN_ARC_LENGTH - 1);
+
+        for (int i = 0; i < length; i++) {
+            const std::uint32_t position = m_nextCoinPosition + static_cast<std::uint32_t>(i * COIN_SPACING);
+            const int arcOffset = 2 * i - (COIN_ARC_LENGTH - 1);
+            const int coinHeight = pattern <= 80 ? height : COIN_MAX_HEIGHT * (arcWidth - arcOffset * arcOffset) / arcWidth;
+
+            if (position < chunkEnd) {
+                m_chunkEntries.push_back(LevelEntry{position, static_cast<std::uint16_t>(coinHeight),
+                                                    static_cast<std::uint8_t>(COIN)});
+            }
+        }
+
+        m_nextCoinPosition += static_cast<std::uint32_t>((length - 1) * COIN_SPACING + ITEM_SIZE
+                + m_randomGenerator.getUniformRandomNumber(COIN_GAP_MIN_STEPS, COIN_GAP_MAX_STEPS) * stepLength);
+    }
+}
+
+/**
+ * @brief Check that all elements of the sorted chunk can be handled by the player
+ * @details Obstacles following the previous one too closely to jump again are dropped.
+ * Coins are then lifted above obstacles and bonuses they overlap,
+ * or dropped if they would be out of reach.
+ * The chunk never holds more than MAX_CHUNK_ENTRIES elements
+ *
+ * @param expectedSpeed the speed expected when the chunk shows up
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LevelGenerator::validateChunk(int expectedSpeed)
+{
+    const std::uint32_t minObstacleGap = static_cast<std::uint32_t>((JUMP_STEPS + SAFETY_STEPS) * expectedSpeed);
+
+    m_blockers.clear();
+    m_blockers.push_back(m_lastObstacle);
+
+    for (LevelEntry& entry : m_chunkEntries) {
+        const auto type = static_cast<MovableElementType>(entry.type);
+
+        if (type == STANDARD_ENEMY || type == TOTEM_ENEMY || type == BLOCK_ENEMY) {
+            if (m_lastObstacle.right != 0 && entry.position - m_lastObstacle.left < minObstacleGap) {
+                entry.type = UNDEFINED;
+            } else {
+                m_lastObstacle = Blocker{entry.position, entry.position + Enemy::getTypeWidth(type),
+                                         0, Enemy::getTypeHeight(type)};
+                m_blockers.push_back(m_lastObstacle);
+            }
+        } else if (type != COIN) {
+            m_blockers.push_back(Blocker{entry.position, entry.position + ITEM_SIZE,
+                                         entry.height, entry.height + ITEM_SIZE});
+        }
+    }
+
+    for (LevelEntry& entry : m_chunkEntries) {
+        if (entry.type == COIN && !placeAboveBlockers(entry)) {
+            entry.type = UNDEFINED;
+        }
+    }
+
+    m_chunkEntries.erase(std::remove_if(m_chunkEntries.begin(), m_chunkEntries.end(),
+                                        [](const LevelEntry& entry) { return entry.type == UNDEFINED; }),
+                         m_chunkEntries.end());
+
+    if (m_chunkEntries.size() > MAX_CHUNK_ENTRIES) {
+        m_chunkEntries.resize(MAX_CHUNK_ENTRIES);
+    }
+}
+
+/**
+ * @brief Lift a coin above all obstacles and bonuses it overlaps
+ *
+ * @param coin the coin entry to update
+ * @return false if the coin would be out of reach
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LevelGenerator::placeAboveBlockers(LevelEntry& coin) const
+{
+    const std::uint32_t left = coin.position - std::min<std::uint32_t>(coin.position, BLOCKER_MARGIN);
+    const std::uint32_t right = coin.position + ITEM_SIZE + BLOCKER_MARGIN;
+    int height = coin.height;
+
+    auto it = m_blockers.begin();
+    while (it != m_blockers.end()) {
+        if (it->left < right && left < it->right && it->bottom < height + ITEM_SIZE && height < it->top) {
+            height = it->top + BLOCKER_MARGIN;
+            if (height > COIN_MAX_HEIGHT) {
+                return false;
+            }
+            it = m_blockers.begin(); //The coin could now overlap a previous blocker
+        } else {
+            ++it;
+        }
+    }
+
+    coin.height = static_cast<std::uint16_t>(height);
+    return true;
+}
@@ -0,0 +1,141 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef LEVEL_GENERATOR_H
+#define LEVEL_GENERATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "app/model/game-components/Bonus.h"
+#include "app/model/game-components/Enemy.h"
+#include "app/model/snapshot/GameSnapshot.h"
+#include "app/model/utils/RandomGenerator.h"
+
+/**
+ * @struct LevelEntry
+ * @details Element waiting in the level queue, positioned on the field:
+ * its left side at a scrolled distance, its bottom at a height above the floor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct LevelEntry
+{
+    std::uint32_t position;
+    std::uint16_t height;
+    std::uint8_t type;
+};
+
+/**
+ * @class LevelGenerator
+ * @details Generate the level ahead of the player as fixed-length chunks of obstacles,
+ * coin patterns and bonuses, drawn from the game's random generator.
+ * Generated elements wait in a fixed capacity queue, sorted by position,
+ * and are taken out by the game as the field scrolls to them.
+ *
+ * Each chunk is validated before being queued: obstacles are far enough apart
+ * to be jumped over one after another at the speed expected when they show up,
+ * and coins overlapping an obstacle or a bonus are lifted above it
+ * or dropped if they can't be reached anymore.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class LevelGenerator
+{
+public:
+    //=== CTORs / DTORs
+    LevelGenerator(RandomGenerator& randomGenerator, int difficulty, std::uint32_t startPosition,
+                   int bonusHeight, int maxSpeed);
+    LevelGenerator(const LevelGenerator&) = delete;
+    ~LevelGenerator();
+
+    //=== GETTERS
+    std::uint32_t getGeneratedLength() const;
+    std::size_t getQueuedCount() const;
+    std::uint32_t getChunkCount() const;
+    static std::size_t getCapacity();
+
+    //=== METHODS
+    bool generateChunk(float speed);
+    bool peek(LevelEntry& entry) const;
+    void pop();
+    void saveSnapshot(GameSnapshot& snapshot) const;
+    bool restoreSnapshot(GameSnapshot& snapshot);
+
+private:
+    /**
+     * @struct Blocker
+     * @details Field area taken by an obstacle or a bonus, coins having to avoid it
+     */
+    struct Blocker
+    {
+        std::uint32_t left;
+        std::uint32_t right;
+        int bottom;
+        int top;
+    };
+
+    //=== ATTRIBUTES
+    RandomGenerator& m_randomGenerator;
+    int m_difficulty;
+    int m_bonusHeight;
+    int m_maxSpeed;
+    std::vector<LevelEntry> m_entries;
+    std::uint32_t m_head;
+    std::uint32_t m_count;
+    std::uint32_t m_chunkCount;
+    std::uint32_t m_generatedLength;
+    std::uint32_t m_nextObstaclePosition;
+    std::uint32_t m_nextCoinPosition;
+    std::uint32_t m_nextBonusPosition;
+    Blocker m_lastObstacle;
+    std::vector<LevelEntry> m_chunkEntries;
+    std::vector<Blocker> m_blockers;
+
+    //Constants
+    static constexpr std::uint32_t QUEUE_CAPACITY = 256;
+    static constexpr std::uint32_t MAX_CHUNK_ENTRIES = 64;
+    const std::uint32_t CHUNK_LENGTH = 1024;
+    const int JUMP_STEPS = 36;
+    const int SAFETY_STEPS = 6;
+    const int SPEED_MARGIN = 3;
+    const int OBSTACLE_GAP_SPREAD_STEPS = 60;
+    const int FIRST_OBSTACLE_MIN_STEPS = 30;
+    const int FIRST_OBSTACLE_MAX_STEPS = 60;
+    const int COIN_GAP_MIN_STEPS = 10;
+    const int COIN_GAP_MAX_STEPS = 60;
+    const int FIRST_BONUS_MIN_STEPS = 300;
+    const int FIRST_BONUS_MAX_STEPS = 450;
+    const int BONUS_GAP_MIN_STEPS = 600;
+    const int BONUS_GAP_MAX_STEPS = 1200;
+    const int ITEM_SIZE = 25;
+    const int COIN_SPACING = 40;
+    const int COIN_ROW_LENGTH = 4;
+    const int COIN_ARC_LENGTH = 5;
+    const int COIN_MAX_HEIGHT = 100;
+    const int BLOCKER_MARGIN = 5;
+
+    //=== PRIVATE METHODS
+    void placeObstacles(std::uint32_t chunkEnd, int expectedSpeed);
+    void placeBonuses(std::uint32_t chunkEnd, int stepLength);
+    void placeCoins(std::uint32_t chunkEnd, int stepLength);
+    void validateChunk(int expectedSpeed);
+    bool placeAboveBlockers(LevelEntry& coin) const;
+};
+
+#endif
@@ -1,59 +1,88 @@
-#include <app/model/utils/GameUtils.h>
 #include "GameModel.h"
+#include "libs/Logger/Tracer.h"
 
+using std::chrono::duration_cast;
 using std::chrono::milliseconds;
-using std::chrono::system_clock;
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
 using std::string;
 using Bokoblin::SimpleLogger::Logger;
 
+constexpr int GameModel::MAX_MOVABLE_ELEMENTS;
+constexpr int GameModel::EVENT_BUFFER_CAPACITY;
+constexpr int GameModel::SPEED_LIMIT;
+constexpr int GameModel::SIMULATION_RATE;
+
 //------------------------------------------------
 //          CONSTRUCTOR / DESTRUCTOR
 //------------------------------------------------
 
 /**
- * @brief Constructor
+ * @brief Constructor of a game with a generated seed
  *
  * @param width the app's width
  * @param height the app's height
  * @param appCore the app's core singleton
  *
  * @author Arthur
- * @date 26/03/2016 - 05/09/2018
+ * @date 26/03/2016 - 17/10/2026
  */
 GameModel::GameModel(float width, float height, AppCore* appCore) :
+        GameModel(width, height, appCore, RandomGenerator::generateSeed())
+{}
+
+/**
+ * @brief Constructor of a game reproducing a given seed
+ *
+ * @param width the app's width
+ * @param height the app's height
+ * @param appCore the app's core singleton
+ * @param seed the seed of the game's random generator
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+GameModel::GameModel(float width, float height, AppCore* appCore, std::uint64_t seed) :
         AbstractModel(appCore), m_width{width}, m_height{height}, m_gameState{RUNNING}, m_inTransition{false},
-        m_isTransitionPossible{false}, m_gameSlowSpeed{0}, m_currentZone{HILL},
-        m_currentEnemySpawnDistance{0}, m_currentCoinSpawnDistance{0}, m_currentBonusSpawnDistance{0},
-        m_scoreBonusFlattenedEnemies{0}, m_lastTime{system_clock::now()}, m_bonusTimeout{0}
+        m_isTransitionPossible{false}, m_gameSlowSpeed{0}, m_currentZone{HILL}, m_scoreBonusFlattenedEnemies{0},
+        m_playerInput{INPUT_NONE}, m_isDecelerationRequested{false}, m_pendingEvents{EVENT_NONE},
+        m_pausedGameState{RUNNING}, m_stepCount{0}, m_lastTime{steady_clock::now()}, m_timeAccumulator{0},
+        m_bonusTimeout{0}, m_stepDistance{0}, m_fieldDistance{0}, m_activatedItems{SHOP_NONE}, m_randomGenerator(seed),
+        m_levelGenerator(m_randomGenerator, appCore->getDifficulty(), static_cast<std::uint32_t>(width),
+                         static_cast<int>(getGameFloorPosition() - 0.63f * height), SPEED_LIMIT),
+        m_inputRecorder{nullptr},
+        m_inputReplay{nullptr}, m_elementStore(MAX_MOVABLE_ELEMENTS),
+        m_sweepIndex(&m_elementStore), m_eventBuffer(EVENT_BUFFER_CAPACITY)
 {
     //=== Initialize new game
 
+    Logger::printInfo("New game seed: ", seed);
     PersistenceManager::fetchActivatedBonus();
+    resolveActivatedItems();
     m_appCore->launchNewGame();
     m_gameSpeed = m_appCore->getDifficulty() * DEFAULT_SPEED;
     addANewMovableElement(DEFAULT_PLAYER_X, getGameFloorPosition(), PLAYER);
 
 
-    //=== Initialize elements spawn distance
+    //=== Generate the beginning of the level
 
-    m_nextCoinSpawnDistance = RandomUtils::getUniformRandomNumber(0, 10);       //Between 0 and 10 meters
-    m_nextEnemySpawnDistance = RandomUtils::getUniformRandomNumber(10, 20);     //Between 10 and 20 meters
-    m_nextBonusSpawnDistance = RandomUtils::getUniformRandomNumber(100, 150);   //Between 100 and 150 meters
+    while (m_levelGenerator.getGeneratedLength() < m_width + LEVEL_LOOKAHEAD
+            && m_levelGenerator.generateChunk(m_gameSpeed)) {}
+
+    m_viewElementsArray.reserve(MAX_MOVABLE_ELEMENTS);
 }
 
 /**
  * @brief Destructor
  *
  * @author Arthur
- * @date 26/03/2016 - 24/12/2017
+ * @date 26/03/2016 - 17/10/2026
  */
 GameModel::~GameModel()
 {
-    for (auto& element : m_movableElementsArray) {
-        delete element;
-    }
-
-    m_movableElementsArray.clear();
+    delete m_player;
+    m_elementStore.clear();
 }
 
 //------------------------------------------------
@@ -67,22 +96,223 @@ float GameModel::getGameSpeed() const { return m_gameSpeed; }
 int GameModel::getBonusTimeout() const { return static_cast<int>(m_bonusTimeout.count() / 1000); } // return seconds
 Zone GameModel::getCurrentZone() const { return m_currentZone; }
 Player* GameModel::getPlayer() const { return m_player; }
-const std::set<MovableElement*>& GameModel::getNewMElementsArray() const { return m_newMovableElementsArray; }
+const std::vector<ElementHandle>& GameModel::getNewMElementsArray() const { return m_newMovableElementsArray; }
+const std::vector<ElementRemoval>& GameModel::getRemovedMElementsArray() const { return m_removedMovableElementsArray; }
+MovableElement GameModel::getMovableElement(const ElementHandle& handle) { return {&m_elementStore, handle}; }
+bool GameModel::isMovableElementAlive(const ElementHandle& handle) const { return m_elementStore.isAlive(handle); }
+unsigned int GameModel::getLiveElementsCount() const { return static_cast<unsigned int>(m_elementStore.getSize()); }
+unsigned int GameModel::getPooledElementsCount() const
+{
+    return static_cast<unsigned int>(m_elementStore.getPooledCount());
+}
 unsigned int GameModel::getGameFloorPosition() const { return static_cast<unsigned int>(0.8f * m_height); }
 bool GameModel::isTransitionRunning() const { return m_inTransition; }
 bool GameModel::isTransitionPossible() const { return m_isTransitionPossible; }
 bool GameModel::isMusicEnabled() const { return m_appCore->isGameMusicEnabled(); }
 
+/**
+ * @brief Get the progression between the last simulation step and the next one
+ * @details Allows the view to interpolate elements positions between two steps
+ *
+ * @return a factor in [0, 1[ range
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+float GameModel::getInterpolationFactor() const
+{
+    const nanoseconds stepDuration = duration_cast<nanoseconds>(seconds(1)) / SIMULATION_RATE;
+    return static_cast<float>(m_timeAccumulator.count()) / stepDuration.count();
+}
+
+int GameModel::getSimulationRate() { return SIMULATION_RATE; }
+std::uint64_t GameModel::getSeed() const { return m_randomGenerator.getSeed(); }
+RandomGenerator& GameModel::getRandomGenerator() { return m_randomGenerator; }
+bool GameModel::isReplaying() const { return m_inputReplay != nullptr; }
+const GameEventBuffer& GameModel::getEventBuffer() const { return m_eventBuffer; }
+
+/**
+ * @brief Get the header identifying this game in an input recording
+ *
+ * @return the header of the game
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+ReplayHeader GameModel::getReplayHeader() const
+{
+    const std::set<string> activatedItems = m_appCore->getActivatedItemsArray();
+    return ReplayHeader{m_randomGenerator.getSeed(), m_appCore->getDifficulty(),
+                        static_cast<unsigned int>(m_width), static_cast<unsigned int>(m_height),
+                        std::vector<string>(activatedItems.begin(), activatedItems.end())};
+}
+unsigned long GameModel::getStepCount() const { return m_stepCount; }
+
+/**
+ * @brief Get the distance between the player and the next enemy in front of him
+ *
+ * @return the distance in pixels, or a negative value if there is no enemy in front of the player
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+float GameModel::getNextEnemyDistance() const
+{
+    const std::size_t playerIndex = m_elementStore.getIndex(m_player->getHandle());
+    const float playerRight = m_elementStore.getPosX(playerIndex) + m_elementStore.getWidth(playerIndex);
+    float nextEnemyDistance = -1;
+
+    for (std::size_t i = 0; i < m_elementStore.getSize(); i++) {
+        const MovableElementType type = m_elementStore.getType(i);
+        const float distance = m_elementStore.getPosX(i) + m_elementStore.getWidth(i) - playerRight;
+
+        if ((type == STANDARD_ENEMY || type == TOTEM_ENEMY || type == BLOCK_ENEMY) && distance >= 0
+                && (nextEnemyDistance < 0 || distance < nextEnemyDistance)) {
+            nextEnemyDistance = distance;
+        }
+    }
+
+    return nextEnemyDistance;
+}
+
 //------------------------------------------------
 //          SETTERS
 //------------------------------------------------
 
-void GameModel::setGameState(const GameState& state) { m_gameState = state; }
-void GameModel::setCurrentZone(const Zone& z) { m_currentZone = z; }
-void GameModel::setTransitionState(bool inTransition) { m_inTransition = inTransition; }
-void GameModel::disableTransitionPossibility() { m_isTransitionPossible = false; }
 void GameModel::toggleGameMusic() { m_appCore->toggleGameMusic(); }
 
+/**
+ * @brief Set the game state
+ * @details A slow resume is recorded as a step event.
+ * While replaying, resuming a pause restores the state the game had before it,
+ * the recorded events deciding of slow resumes
+ *
+ * @param state the new game state
+ *
+ * @author Arthur
+ * @date 26/03/2016 - 17/10/2026
+ */
+void GameModel::setGameState(const GameState& state)
+{
+    if (state == PAUSED) {
+        if (m_gameState != PAUSED) {
+            m_pausedGameState = m_gameState;
+        }
+    } else if (isReplaying() && m_gameState == PAUSED) {
+        m_gameState = m_pausedGameState;
+        return;
+    } else if (state == RUNNING_SLOWLY && m_gameState != RUNNING_SLOWLY) {
+        m_pendingEvents |= EVENT_SLOWLY_RESUMED;
+    }
+
+    m_gameState = state;
+}
+
+/**
+ * @brief Set the current zone, recorded as a step event
+ * @details Ignored while replaying, the recorded events being applied instead
+ *
+ * @param z the new zone
+ *
+ * @author Arthur
+ * @date 26/03/2016 - 17/10/2026
+ */
+void GameModel::setCurrentZone(const Zone& z)
+{
+    TRACE_SCOPE("model", "GameModel::setCurrentZone");
+    if (!isReplaying() && z != m_currentZone) {
+        m_currentZone = z;
+        m_pendingEvents |= EVENT_ZONE_CHANGED;
+    }
+}
+
+/**
+ * @brief Set if a zone transition is running, recorded as a step event
+ * @details Ignored while replaying, the recorded events being applied instead
+ *
+ * @param inTransition true if a transition is running
+ *
+ * @author Arthur
+ * @date 26/03/2016 - 17/10/2026
+ */
+void GameModel::setTransitionState(bool inTransition)
+{
+    if (!isReplaying() && inTransition != m_inTransition) {
+        m_inTransition = inTransition;
+        m_pendingEvents |= inTransition ? EVENT_TRANSITION_STARTED : EVENT_TRANSITION_ENDED;
+    }
+}
+
+/**
+ * @brief Disable the zone transition possibility, recorded as a step event
+ * @details Ignored while replaying, the recorded events being applied instead
+ *
+ * @author Arthur
+ * @date 26/03/2016 - 17/10/2026
+ */
+void GameModel::disableTransitionPossibility()
+{
+    if (!isReplaying() && m_isTransitionPossible) {
+        m_isTransitionPossible = false;
+        m_pendingEvents |= EVENT_TRANSITION_DISABLED;
+    }
+}
+
+/**
+ * @brief Set the player actions held since last frame
+ * @details They will be applied on each simulation step until changed
+ *
+ * @param input a combination of PlayerInput flags
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::setPlayerInput(unsigned int input)
+{
+    m_playerInput = input;
+}
+
+/**
+ * @brief Request the player deceleration
+ * @details Unlike held actions, it will be applied on next simulation step only
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::requestPlayerDeceleration()
+{
+    m_isDecelerationRequested = true;
+}
+
+/**
+ * @brief Record the input and events of all next steps
+ * @details The recorder should be opened with getReplayHeader() before the first step
+ *
+ * @param recorder the recorder, nullptr to stop recording
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::setInputRecorder(InputRecorder* recorder)
+{
+    m_inputRecorder = recorder;
+}
+
+/**
+ * @brief Take the input and events of all next steps from a recording
+ * @details The game should have been created with the recording's header values.
+ * While replaying, the player input and the changes applied from outside of steps are ignored
+ *
+ * @param replay the loaded recording, nullptr to stop replaying
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::setInputReplay(InputReplay* replay)
+{
+    m_inputReplay = replay;
+}
+
 //------------------------------------------------
 //          PUBLIC METHODS
 //------------------------------------------------
@@ -90,60 +320,207 @@ void GameModel::toggleGameMusic() { m_appCore->toggleGameMusic(); }
 /**
  * @brief Handle game mode changing and game's evolution
  * (elements apparition, behaviours, deletion)
+ * @details Elapsed time since last call is accumulated and consumed
+ * by fixed simulation steps, so that the game speed doesn't depend on the frame rate.
+ * The number of steps per call is bounded to avoid a spiral of death on slow devices.
  *
  * @author Arthur
- * @date 21/02/2016 - 22/03/2020
+ * @date 21/02/2016 - 17/10/2026
  */
 void GameModel::nextStep()
 {
+    TRACE_SCOPE("model", "GameModel::nextStep");
+    const steady_clock::time_point now = steady_clock::now();
+
     if (m_gameState == RUNNING || m_gameState == RUNNING_SLOWLY) {
-        handleMovableElementsCollisions();
+        const nanoseconds stepDuration = duration_cast<nanoseconds>(seconds(1)) / SIMULATION_RATE;
+        m_timeAccumulator += duration_cast<nanoseconds>(now - m_lastTime);
+        m_timeAccumulator = std::min(m_timeAccumulator, stepDuration * MAX_STEPS_PER_FRAME);
 
-        system_clock::duration currentNextStepDelay = system_clock::now() - m_lastTime;
-        system_clock::duration nextStepDelay = milliseconds(NEXT_STEP_DELAY);
+        while (m_timeAccumulator >= stepDuration
+                && (m_gameState == RUNNING || m_gameState == RUNNING_SLOWLY)) {
+            simulateStep();
+            m_timeAccumulator -= stepDuration;
+        }
+    } else {
+        m_timeAccumulator = nanoseconds(0);
+    }
+
+    m_lastTime = now;
+}
 
-        if (currentNextStepDelay.count() > nextStepDelay.count()) {
-            handleSpeedAndDistance();
-            handleMovableElementsCreation();
-            handleMovableElementsDeletion();
-            handleBonusTimeout();
+/**
+ * @brief Run one fixed simulation step
+ * @details Movements, elements creation and collisions are handled on every step
+ * while speed, level generation, deletion and timeouts are handled every NEXT_STEP_DELAY.
+ * It can be called directly to run the game without wall-clock gating
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::simulateStep()
+{
+    TRACE_SCOPE("model", "GameModel::simulateStep");
+    const unsigned long stepsPerDelay = static_cast<unsigned long>(SIMULATION_RATE * NEXT_STEP_DELAY / 1000);
+    unsigned int input = m_playerInput | (m_isDecelerationRequested ? INPUT_DECELERATE : INPUT_NONE);
+    unsigned int events = m_pendingEvents;
 
-            conditionallyAllowZoneTransition();
-            conditionallyTriggerGameOver();
+    m_isDecelerationRequested = false;
+    m_pendingEvents = EVENT_NONE;
 
-            m_lastTime = system_clock::now();
+    if (m_inputReplay != nullptr) {
+        if (!m_inputReplay->readNextStep(input, events)) {
+            input = INPUT_NONE;
+            events = EVENT_NONE;
         }
+        applyStepEvents(events);
+    }
+    if (m_inputRecorder != nullptr) {
+        m_inputRecorder->recordStep(input, events);
+    }
+
+    applyPlayerInput(input);
+    moveMovableElements();
+    handleMovableElementsCreation();
+    handleMovableElementsCollisions();
+
+    m_stepCount++;
+    if (m_stepCount % stepsPerDelay == 0) {
+        handleSpeedAndDistance();
+        handleLevelGeneration();
+        handleMovableElementsDeletion();
+        handleBonusTimeout();
+
+        conditionallyAllowZoneTransition();
+        conditionallyTriggerGameOver();
     }
 }
 
 /**
- * @brief Save current game progress
+ * @brief End the game and calculate its final score
  *
  * @author Arthur
- * @date 30/10/18
+ * @date 27/03/2016 - 17/10/2026
  */
-void GameModel::saveCurrentGame()
+void GameModel::endGame()
 {
-    m_appCore->saveCurrentGame();
+    TRACE_SCOPE("model", "GameModel::endGame");
+    m_gameState = OVER;
+    m_appCore->calculateFinalScore(m_gameSpeed, m_scoreBonusFlattenedEnemies);
 }
 
 /**
- * @brief Allow all elements to trigger their move function
+ * @brief Save the whole running game to a snapshot
+ * @details The snapshot's previous content is replaced, its memory being reused.
+ * Input recorder and replay aren't part of the game's state
  *
- * @param currentElement the element to move
+ * @param snapshot the snapshot to write to
  *
  * @author Arthur
- * @date 06/03/16 - 26/03/16
+ * @date 17/10/2026
  */
-void GameModel::moveMovableElement(MovableElement* currentElement)
+void GameModel::saveSnapshot(GameSnapshot& snapshot) const
 {
-    if (currentElement == m_player) {
-        currentElement->move();
-    } else if (currentElement != nullptr) {
-        repeat(this->m_gameSpeed) {
-            currentElement->move();
-        }
+    TRACE_SCOPE("model", "GameModel::saveSnapshot");
+    snapshot.clear();
+
+    snapshot.write(m_width);
+    snapshot.write(m_height);
+    snapshot.write(m_gameState);
+    snapshot.write(m_inTransition);
+    snapshot.write(m_isTransitionPossible);
+    snapshot.write(m_gameSpeed);
+    snapshot.write(m_gameSlowSpeed);
+    snapshot.write(m_currentZone);
+    snapshot.write(m_scoreBonusFlattenedEnemies);
+    snapshot.write(m_playerInput);
+    snapshot.write(m_isDecelerationRequested);
+    snapshot.write(m_pendingEvents);
+    snapshot.write(m_pausedGameState);
+    snapshot.write(m_stepCount);
+    snapshot.write(static_cast<std::int64_t>(m_timeAccumulator.count()));
+    snapshot.write(static_cast<std::int64_t>(m_bonusTimeout.count()));
+    snapshot.write(m_stepDistance);
+    snapshot.write(m_fieldDistance);
+    snapshot.write(m_activatedItems);
+    snapshot.write(m_randomGenerator.getSeed());
+    snapshot.write(m_randomGenerator.getState());
+    snapshot.write(m_randomGenerator.getIncrement());
+
+    for (std::size_t i = 0; i < GAME_COUNTER_COUNT; i++) {
+        snapshot.write(m_appCore->getGameValue(static_cast<GameCounter>(i)));
+    }
+
+    m_player->saveSnapshot(snapshot);
+    m_elementStore.saveSnapshot(snapshot);
+    m_sweepIndex.saveSnapshot(snapshot);
+    m_levelGenerator.saveSnapshot(snapshot);
+}
+
+/**
+ * @brief Restore the whole game from a snapshot
+ * @details The snapshot must come from a game of the same size.
+ * The current game is saved first and restored back if the snapshot is invalid,
+ * so that a failed restore leaves the game unchanged.
+ * Elements changes are reported to the view as new and removed elements,
+ * so that its sprites match the restored elements.
+ * Wall-clock gating restarts from now, input recorder and replay being left as they are
+ *
+ * @param snapshot the snapshot to read from
+ * @return true if the game was restored
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool GameModel::restoreSnapshot(GameSnapshot& snapshot)
+{
+    TRACE_SCOPE("model", "GameModel::restoreSnapshot");
+    float width = 0, height = 0;
+
+    snapshot.rewind();
+    if (!snapshot.read(width) || !snapshot.read(height) || width != m_width || height != m_height) {
+        Logger::printError("Game snapshot doesn't match the current game");
+        return false;
     }
+
+    saveSnapshot(m_rollbackSnapshot);
+    collectViewElements();
+
+    if (!readSnapshot(snapshot)) {
+        Logger::printError("Game snapshot is invalid, the game is left unchanged");
+        readSnapshot(m_rollbackSnapshot);
+        return false;
+    }
+
+    m_lastTime = steady_clock::now();
+    notifyRestoredElements();
+    return true;
+}
+
+/**
+ * @brief Resolve the shop items activated for this game
+ * @details Items are checked through flags while the game runs.
+ * It's called on creation, and must be called again if activated items
+ * are replaced before the first step (e.g. to replay a game)
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::resolveActivatedItems()
+{
+    m_activatedItems = m_appCore->getActivatedItemsFlags();
+}
+
+/**
+ * @brief Save current game progress
+ *
+ * @author Arthur
+ * @date 30/10/18 - 17/10/2026
+ */
+void GameModel::saveCurrentGame()
+{
+    TRACE_SCOPE("model", "GameModel::saveCurrentGame");
+    m_appCore->saveCurrentGame();
 }
 
 /**
@@ -157,10 +534,92 @@ void GameModel::clearNewMovableElementList()
     m_newMovableElementsArray.clear();
 }
 
+/**
+ * @brief Clean the list of removed movable elements
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::clearRemovedMovableElementList()
+{
+    m_removedMovableElementsArray.clear();
+}
+
 //------------------------------------------------
 //          PRIVATE METHODS
 //------------------------------------------------
 
+/**
+ * @brief Apply the player actions to the player
+ *
+ * @param input the step's PlayerInput flags
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::applyPlayerInput(unsigned int input)
+{
+    if (input & INPUT_LEFT) {
+        m_player->controlPlayerMovements(MOVE_LEFT);
+    } else if (input & INPUT_RIGHT) {
+        m_player->controlPlayerMovements(MOVE_RIGHT);
+    }
+
+    if (input & INPUT_JUMP) {
+        m_player->jump();
+    }
+
+    if (input & INPUT_DECELERATE) {
+        m_player->decelerate();
+    }
+}
+
+/**
+ * @brief Apply replayed changes which were made from outside of steps when recording
+ *
+ * @param events the step's StepEvent flags
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::applyStepEvents(unsigned int events)
+{
+    if (events & EVENT_TRANSITION_STARTED) {
+        m_inTransition = true;
+    }
+    if (events & EVENT_TRANSITION_ENDED) {
+        m_inTransition = false;
+    }
+    if (events & EVENT_TRANSITION_DISABLED) {
+        m_isTransitionPossible = false;
+    }
+    if (events & EVENT_ZONE_CHANGED) {
+        m_currentZone = m_currentZone == HILL ? PLAIN : HILL;
+    }
+    if (events & EVENT_SLOWLY_RESUMED) {
+        m_gameState = RUNNING_SLOWLY;
+    }
+}
+
+/**
+ * @brief Allow all elements to trigger their move function
+ * @details Elements travel the whole step distance in a single move,
+ * the game speed being the number of pixels travelled per step.
+ * The field distance scrolls along
+ *
+ * @author Arthur
+ * @date 06/03/16 - 17/10/2026
+ */
+void GameModel::moveMovableElements()
+{
+    m_stepDistance = std::ceil(m_gameSpeed);
+    m_fieldDistance += static_cast<std::uint32_t>(m_stepDistance);
+
+    m_elementStore.savePreviousPositions();
+    m_player->move();
+    m_elementStore.advance(m_stepDistance);
+}
+
 /**
  * @brief Handle speed and distance increase
  *
@@ -176,82 +635,92 @@ void GameModel::handleSpeedAndDistance()
     m_appCore->increaseCurrentDistance(m_gameSpeed / SPEED_DISTANCE_RATIO);
 }
 
+/**
+ * @brief Generate the level ahead of the player
+ * @details At most a chunk is generated per call, keeping
+ * at least LEVEL_LOOKAHEAD pixels of level beyond the screen
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::handleLevelGeneration()
+{
+    TRACE_SCOPE("model", "GameModel::handleLevelGeneration");
+    if (m_levelGenerator.getGeneratedLength() < m_fieldDistance + m_width + LEVEL_LOOKAHEAD) {
+        m_levelGenerator.generateChunk(m_gameSpeed);
+    }
+}
+
 /**
  * @brief Handle elements creation
+ * @details Queued level elements reached by the screen's right side are created
+ * at their exact field position. No element is created while a zone transition is possible
  *
  * @author Arthur
- * @date 12/04/16 - 06/09/18
+ * @date 12/04/16 - 17/10/2026
  */
 void GameModel::handleMovableElementsCreation()
 {
-    if (!m_isTransitionPossible && checkIfPositionFree(m_width, getGameFloorPosition())) {
-        //=== Add new enemies
-
-        if (m_currentEnemySpawnDistance >= m_nextEnemySpawnDistance) {
-            float pos_x = m_width;
-            float pos_y = getGameFloorPosition();
-            addANewMovableElement(pos_x, pos_y, STANDARD_ENEMY);
-
-            m_currentEnemySpawnDistance = 0;
-            m_nextEnemySpawnDistance = GameUtils::chooseSpawnDistance(m_nextEnemySpawnDistance, STANDARD_ENEMY);
-            if (m_appCore->getDifficulty() != EASY) {
-                m_nextEnemySpawnDistance /= 2;
-            }
-            return; //to not add another element if spawn distance valid
-        } else {
-            m_currentEnemySpawnDistance++;
-        }
-
-        //=== Add new Coins
-
-        if (m_currentCoinSpawnDistance >= m_nextCoinSpawnDistance) {
-            float pos_x = m_width;
-            float pos_y = getGameFloorPosition() - RandomUtils::getUniformRandomNumber(0, 100);
-            addANewMovableElement(pos_x, pos_y, COIN);
+    const std::uint32_t screenEnd = m_fieldDistance + static_cast<std::uint32_t>(m_width);
+    LevelEntry entry{};
 
-            m_currentCoinSpawnDistance = 0;
-            m_nextCoinSpawnDistance = GameUtils::chooseSpawnDistance(m_nextCoinSpawnDistance, COIN);
-            return;
-        } else {
-            m_currentCoinSpawnDistance++;
-        }
-
-        //=== Add new Bonus
+    while (m_levelGenerator.peek(entry) && entry.position <= screenEnd) {
+        m_levelGenerator.pop();
 
-        if (m_currentBonusSpawnDistance >= m_nextBonusSpawnDistance) {
-            float pos_x = m_width;
-            float pos_y = 0.63f * m_height;
-            addANewMovableElement(pos_x, pos_y, PV_PLUS_BONUS);
-
-            m_currentBonusSpawnDistance = 0;
-            m_nextBonusSpawnDistance = GameUtils::chooseSpawnDistance(m_nextBonusSpawnDistance, PV_PLUS_BONUS);
-            return;
-        } else {
-            m_currentBonusSpawnDistance++;
+        if (!m_isTransitionPossible) {
+            addANewMovableElement(static_cast<float>(entry.position - m_fieldDistance),
+                                  static_cast<float>(getGameFloorPosition()) - entry.height, entry.type);
         }
     }
 }
 
 /**
  * @brief Handle Movable Elements Collisions
- * @warning It must be executed outside of the next step delay
+ * @details Elements near the player are tested all at once against the player box
+ * widened by their relative move since the previous step, so that fast elements
+ * can't pass through the player in a single step
+ * @warning It must be executed on each simulation step
  * to prevent high speed collisions skipping
  *
  * @author Arthur
- * @date 12/03/16 - 13/07/2019
+ * @date 12/03/16 - 17/10/2026
  */
 void GameModel::handleMovableElementsCollisions()
 {
-    for (MovableElement* element : m_movableElementsArray) {
-        if (!element->isColliding() && element->getType() != PLAYER && element->collide(*m_player)) {
+    TRACE_SCOPE("model", "GameModel::handleMovableElementsCollisions");
+    const std::size_t playerIndex = m_elementStore.getIndex(m_player->getHandle());
+    const float playerPosX = m_elementStore.getPosX(playerIndex);
+    const float playerPosY = m_elementStore.getPosY(playerIndex);
+    const float relativeMove = m_stepDistance + playerPosX - m_elementStore.getPreviousPosX(playerIndex);
+    const float left = playerPosX - std::max(0.0f, relativeMove);
+    const float right = playerPosX + m_elementStore.getWidth(playerIndex) - std::min(0.0f, relativeMove);
+    const float top = playerPosY - m_elementStore.getHeight(playerIndex);
+
+    m_nearbyElementsArray.clear();
+    m_sweepIndex.query(left, right, m_nearbyElementsArray);
+
+    m_elementStore.fillBoundingBoxes(m_nearbyElementsArray, m_nearbyBoxes);
+
+    CollisionUtils::findOverlaps(left, top, right, playerPosY, m_nearbyBoxes, m_hitMask);
+
+    for (std::size_t k = 0; k < m_nearbyElementsArray.size(); k++) {
+        const std::size_t i = m_nearbyElementsArray[k];
+        const MovableElementType type = m_elementStore.getType(i);
+
+        if (CollisionUtils::isHit(m_hitMask, k) && !m_elementStore.isColliding(i)) {
+            m_elementStore.setColliding(i);
+
             //Apply different behaviours following element type
-            switch (element->getType()) {
+            switch (type) {
                 case STANDARD_ENEMY:
                 case TOTEM_ENEMY:
                 case BLOCK_ENEMY:
-                    handleEnemyCollision(element->getType());
+                    publishEvent(m_player->getState() == MEGA ? ENEMY_FLATTENED : ENEMY_HIT,
+                                 type, m_elementStore.getHandle(i));
+                    handleEnemyCollision(type);
                     break;
                 case COIN:
+                    publishEvent(COIN_COLLECTED, type, m_elementStore.getHandle(i));
                     handleCoinCollision();
                     break;
                 case PV_PLUS_BONUS:
@@ -259,7 +728,8 @@ void GameModel::handleMovableElementsCollisions()
                 case FLY_BONUS:
                 case SLOW_SPEED_BONUS:
                 case SHIELD_BONUS:
-                    handleBonusCollision(element->getType());
+                    publishEvent(BONUS_ACTIVATED, type, m_elementStore.getHandle(i));
+                    handleBonusCollision(type);
                     break;
                 default:
                     Logger::printError("Undefined element type");
@@ -271,20 +741,29 @@ void GameModel::handleMovableElementsCollisions()
 
 /**
  * @brief Handle Movable Elements Deletion
- * @warning The element pointer will only be deleted in destructor
+ * @details Every element having left the screen or collided with the player
+ * is given back to the pool. The removal is recorded so that the view
+ * can release related resources, elements leaving the screen being published as despawned
  *
  * @author Arthur
- * @date 12/03/16 - 13/09/18
+ * @date 12/03/16 - 17/10/2026
  */
 void GameModel::handleMovableElementsDeletion()
 {
-    auto it = m_movableElementsArray.begin();
-    while (it != m_movableElementsArray.end()) {
-        if (((*it)->getPosX() + (*it)->getWidth()) < 0 || (*it)->isColliding()) {
-            m_movableElementsArray.erase(it);
-            it = m_movableElementsArray.end();
+    std::size_t i = 0;
+
+    while (i < m_elementStore.getSize()) {
+        if ((m_elementStore.getPosX(i) + m_elementStore.getWidth(i)) < 0 || m_elementStore.isColliding(i)) {
+            const ElementHandle handle = m_elementStore.getHandle(i);
+            if (!m_elementStore.isColliding(i)) {
+                publishEvent(ELEMENT_DESPAWNED, m_elementStore.getType(i), handle);
+            }
+            m_removedMovableElementsArray.push_back(
+                    ElementRemoval{handle, m_elementStore.getType(i), m_elementStore.isColliding(i)});
+            m_sweepIndex.remove(handle);
+            m_elementStore.destroy(handle); //Last element is moved at index i
         } else {
-            ++it;
+            i++;
         }
     }
 }
@@ -328,12 +807,11 @@ void GameModel::handleEnemyCollision(const MovableElementType& enemyType)
  * @brief Handle a collision between the player and a coin
  *
  * @author Arthur, Florian
- * @date 25/02/16 - 27/12/2017
+ * @date 25/02/16 - 17/10/2026
  */
 void GameModel::handleCoinCollision() const
 {
-    m_appCore->increaseCurrentCoinsCollected(
-            m_appCore->findActivatedItem("doubler") ? 2 : 1);
+    m_appCore->increaseCurrentCoinsCollected((m_activatedItems & SHOP_DOUBLER) ? 2 : 1);
 }
 
 /**
@@ -342,7 +820,7 @@ void GameModel::handleCoinCollision() const
  * @param bonusType the type of bonus having collided with player
  *
  * @author Arthur, Florian
- * @date 25/02/16 - 13/01/2019
+ * @date 25/02/16 - 17/10/2026
  */
 void GameModel::handleBonusCollision(const MovableElementType& bonusType)
 {
@@ -350,21 +828,21 @@ void GameModel::handleBonusCollision(const MovableElementType& bonusType)
         m_player->heal(PV_BONUS_INCREASE);
     } else if (bonusType == MEGA_BONUS) {
         m_player->changeState(MEGA);
-        m_bonusTimeout = milliseconds(m_appCore->findActivatedItem("shop_mega_plus")
+        m_bonusTimeout = milliseconds((m_activatedItems & SHOP_MEGA_PLUS)
                                               ? MEGA_TIMEOUT + ADDITIONAL_TIMEOUT
                                               : MEGA_TIMEOUT);
     } else if (bonusType == FLY_BONUS) {
         m_player->changeState(FLYING);
-        m_bonusTimeout = milliseconds(m_appCore->findActivatedItem("shop_fly_plus")
+        m_bonusTimeout = milliseconds((m_activatedItems & SHOP_FLY_PLUS)
                                               ? FLY_TIMEOUT + ADDITIONAL_TIMEOUT
                                               : FLY_TIMEOUT);
-    } else if (bonusType == SLOW_SPEED_TIMEOUT) {
+    } else if (bonusType == SLOW_SPEED_BONUS) {
         m_gameState = RUNNING_SLOWLY;
         m_gameSpeed /= SLOW_SPEED_BONUS_DIVIDER;
         m_gameSlowSpeed = m_gameSpeed;
         m_bonusTimeout = milliseconds(SLOW_SPEED_TIMEOUT);
     } else if (bonusType == SHIELD_BONUS) {
-        m_player->changeState(m_appCore->findActivatedItem("shop_shield_plus") ? HARD_SHIELDED : SHIELDED);
+        m_player->changeState((m_activatedItems & SHOP_SHIELD_PLUS) ? HARD_SHIELDED : SHIELDED);
     } else {
         Logger::printError("Undefined bonus type");
     }
@@ -400,14 +878,15 @@ void GameModel::handleBonusTimeout()
  * to authorize a zone transition as soon as possible
  *
  * @author Arthur
- * @date 30/04/16 - 13/01/2019
+ * @date 30/04/16 - 17/10/2026
  */
 void GameModel::conditionallyAllowZoneTransition()
 {
-    if (!m_inTransition
-            && m_appCore->getGameMap().at("distance") != 0
-            && m_appCore->getGameMap().at("distance") % ZONE_CHANGING_DISTANCE == 0) {
+    const int distance = m_appCore->getGameValue(CURRENT_DISTANCE);
+
+    if (!m_inTransition && !m_isTransitionPossible && distance != 0 && distance % ZONE_CHANGING_DISTANCE == 0) {
         m_isTransitionPossible = true;
+        publishEvent(ZONE_TRANSITION_ALLOWED, UNDEFINED, ElementHandle{0, 0});
     }
 }
 
@@ -416,75 +895,186 @@ void GameModel::conditionallyAllowZoneTransition()
  * if player's life has ended
  *
  * @author Arthur
- * @date 27/03/2016 - 13/07/2019
+ * @date 27/03/2016 - 17/10/2026
  */
 void GameModel::conditionallyTriggerGameOver()
 {
     if (m_player->getLife() == Player::MIN_ENERGY) {
-        m_gameState = OVER;
-        m_appCore->calculateFinalScore(m_gameSpeed, m_scoreBonusFlattenedEnemies);
+        endGame();
+    }
+}
+
+/**
+ * @brief Add a new movable element to the game
+ *
+ * @param posX the initial x-position of the new element
+ * @param posY the initial y-position of the new element
+ * @param type the type of the new element
+ *
+ * @author Arthur, Florian
+ * @date 25/02/2016 - 17/10/2026
+ */
+void GameModel::addANewMovableElement(float posX, float posY, int type)
+{
+    if (m_elementStore.isFull()) {
+        Logger::printWarning("Movable elements pool is full : element can't be created");
+        return;
+    }
+
+    if (type == PLAYER) {
+        m_player = new Player(&m_elementStore, posX, posY, ELEMENT_SIZE, ELEMENT_SIZE, 2.0, getGameFloorPosition(),
+                              static_cast<int>(m_width), static_cast<int>(0.515f * m_height));
+        m_newMovableElementsArray.push_back(m_player->getHandle());
+    } else if (type == STANDARD_ENEMY || type == TOTEM_ENEMY || type == BLOCK_ENEMY) {
+        Enemy enemy(&m_elementStore, posX, posY, ELEMENT_MOVE_X, static_cast<MovableElementType>(type));
+        m_sweepIndex.insert(enemy.getHandle());
+        m_newMovableElementsArray.push_back(enemy.getHandle());
+    } else if (type == COIN) {
+        Coin coin(&m_elementStore, posX, posY, ITEM_SIZE, ITEM_SIZE, ELEMENT_MOVE_X);
+        m_sweepIndex.insert(coin.getHandle());
+        m_newMovableElementsArray.push_back(coin.getHandle());
+    } else if (type == PV_PLUS_BONUS || type == MEGA_BONUS || type == FLY_BONUS
+            || type == SLOW_SPEED_BONUS || type == SHIELD_BONUS) {
+        Bonus bonus(&m_elementStore, posX, posY, ITEM_SIZE, ITEM_SIZE, ELEMENT_MOVE_X,
+                    static_cast<MovableElementType>(type));
+        m_sweepIndex.insert(bonus.getHandle());
+        m_newMovableElementsArray.push_back(bonus.getHandle());
+    } else {
+        Logger::printError("Undefined element type");
     }
 }
 
 /**
- * @brief Check if a position is free to use
+ * @brief Read the whole game from a snapshot, checking each value
+ * @details Values are read in place: if the snapshot is invalid,
+ * the game is partly overwritten and must be read again from a valid snapshot
  *
- * @param x element x-position
- * @param y element y-position
- * @return a boolean indicating if parameterized position is free
+ * @param snapshot the snapshot to read from
+ * @return true if the snapshot held a valid game of the same size
  *
  * @author Arthur
- * @date 08/03/2016 - 30/04/2016
+ * @date 17/10/2026
  */
-bool GameModel::checkIfPositionFree(float x, float y) const
+bool GameModel::readSnapshot(GameSnapshot& snapshot)
 {
-    bool positionIsFree = true;
-    auto it = m_movableElementsArray.begin();
+    float width = 0, height = 0;
+    std::int64_t timeAccumulator = 0, bonusTimeout = 0;
+    std::uint64_t seed = 0, state = 0, increment = 0;
+    int gameValue = 0;
 
-    while (positionIsFree && it != m_movableElementsArray.end()) {
-        if ((*it)->contains(x, y)) {
-            positionIsFree = false;
-        } else {
-            ++it;
+    snapshot.rewind();
+    bool isValid = snapshot.read(width) && snapshot.read(height) && width == m_width && height == m_height
+            && snapshot.readEnum(m_gameState, RUNNING, OVER)
+            && snapshot.read(m_inTransition)
+            && snapshot.read(m_isTransitionPossible)
+            && snapshot.read(m_gameSpeed)
+            && snapshot.read(m_gameSlowSpeed)
+            && snapshot.readEnum(m_currentZone, HILL, PLAIN)
+            && snapshot.read(m_scoreBonusFlattenedEnemies)
+            && snapshot.read(m_playerInput)
+            && snapshot.read(m_isDecelerationRequested)
+            && snapshot.read(m_pendingEvents)
+            && snapshot.readEnum(m_pausedGameState, RUNNING, OVER)
+            && snapshot.read(m_stepCount)
+            && snapshot.read(timeAccumulator)
+            && snapshot.read(bonusTimeout)
+            && snapshot.read(m_stepDistance)
+            && snapshot.read(m_fieldDistance)
+            && snapshot.read(m_activatedItems)
+            && snapshot.read(seed)
+            && snapshot.read(state)
+            && snapshot.read(increment);
+
+    for (std::size_t i = 0; i < GAME_COUNTER_COUNT; i++) {
+        isValid = isValid && snapshot.read(gameValue);
+        if (isValid) {
+            m_appCore->setGameValue(static_cast<GameCounter>(i), gameValue);
         }
     }
 
-    return positionIsFree;
+    isValid = isValid
+            && m_player->restoreSnapshot(snapshot)
+            && m_elementStore.restoreSnapshot(snapshot)
+            && m_elementStore.isAlive(m_player->getHandle())
+            && m_sweepIndex.restoreSnapshot(snapshot)
+            && m_levelGenerator.restoreSnapshot(snapshot);
+
+    if (isValid) {
+        m_timeAccumulator = nanoseconds(timeAccumulator);
+        m_bonusTimeout = milliseconds(bonusTimeout);
+        m_randomGenerator.restore(seed, state, increment);
+    }
+    return isValid;
 }
 
 /**
- * @brief Add a new movable element to the game
+ * @brief Collect the elements which the view currently has sprites for
+ * @details These are the live elements not yet reported as new,
+ * and the removed elements not yet reported as removed
  *
- * @param posX the initial x-position of the new element
- * @param posY the initial y-position of the new element
- * @param type the type of the new element
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::collectViewElements()
+{
+    m_viewElementsArray.clear();
+
+    for (std::size_t i = 0; i < m_elementStore.getSize(); i++) {
+        const ElementHandle handle = m_elementStore.getHandle(i);
+        if (std::find(m_newMovableElementsArray.begin(), m_newMovableElementsArray.end(), handle)
+                == m_newMovableElementsArray.end()) {
+            m_viewElementsArray.push_back(ElementRemoval{handle, m_elementStore.getType(i), false});
+        }
+    }
+
+    m_viewElementsArray.insert(m_viewElementsArray.end(),
+                               m_removedMovableElementsArray.begin(), m_removedMovableElementsArray.end());
+
+    std::sort(m_viewElementsArray.begin(), m_viewElementsArray.end(),
+              [](const ElementRemoval& a, const ElementRemoval& b) { return a.handle < b.handle; });
+}
+
+/**
+ * @brief Report the differences between the elements known by the view and the restored ones
+ * @details A handle identifies a single element of a game, so elements kept
+ * by the restore keep their sprite
  *
- * @author Arthur, Florian
- * @date 25/02/2016 - 16/09/2018
+ * @author Arthur
+ * @date 17/10/2026
  */
-void GameModel::addANewMovableElement(float posX, float posY, int type)
+void GameModel::notifyRestoredElements()
 {
-    const float ELEMENT_MOVE_X = getGameSpeed() * (-1);
-    MovableElement* newElement = nullptr;
+    m_newMovableElementsArray.clear();
+    m_removedMovableElementsArray.clear();
 
-    if (type == PLAYER) {
-        m_player = new Player(posX, posY, ELEMENT_SIZE, ELEMENT_SIZE, 2.0, 18.0, getGameFloorPosition(),
-                              static_cast<int>(m_width), static_cast<int>(0.515f * m_height));
-        newElement = m_player;
-    } else if (type == STANDARD_ENEMY) { //any enemy, transformation in CTOR
-        newElement = new Enemy(posX, posY, ELEMENT_SIZE, ELEMENT_SIZE, ELEMENT_MOVE_X, ELEMENT_MOVE_Y);
-    } else if (type == COIN) {
-        newElement = new Coin(posX, posY, ITEM_SIZE, ITEM_SIZE, ELEMENT_MOVE_X, ELEMENT_MOVE_Y);
-    } else if (type == PV_PLUS_BONUS) { //any bonus, transformation in CTOR
-        newElement = new Bonus(posX, posY, ITEM_SIZE, ITEM_SIZE, ELEMENT_MOVE_X, ELEMENT_MOVE_Y);
-    } else {
-        Logger::printError("Undefined element type");
+    for (const ElementRemoval& viewElement : m_viewElementsArray) {
+        if (!m_elementStore.isAlive(viewElement.handle)) {
+            m_removedMovableElementsArray.push_back(viewElement);
+        }
     }
 
-    if (newElement == nullptr) {
-        Logger::printError("NULL value : movable element can't be created");
-    } else {
-        m_newMovableElementsArray.insert(newElement);
-        m_movableElementsArray.insert(newElement);
+    for (std::size_t i = 0; i < m_elementStore.getSize(); i++) {
+        const ElementHandle handle = m_elementStore.getHandle(i);
+        const auto it = std::lower_bound(m_viewElementsArray.begin(), m_viewElementsArray.end(), handle,
+                                         [](const ElementRemoval& a, const ElementHandle& b) { return a.handle < b; });
+        if (it == m_viewElementsArray.end() || it->handle != handle) {
+            m_newMovableElementsArray.push_back(handle);
+        }
     }
 }
+
+/**
+ * @brief Publish a gameplay event of the current step
+ *
+ * @param type the event type
+ * @param elementType the type of the involved element, UNDEFINED if none
+ * @param handle the handle of the involved element, meaningless if none
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameModel::publishEvent(const GameEventType& type, const MovableElementType& elementType,
+                             const ElementHandle& handle)
+{
+    m_eventBuffer.publish(GameEvent{type, elementType, handle, m_stepCount});
+}
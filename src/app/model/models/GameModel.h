@@ -16,13 +16,27 @@ limitations under the License.
 #ifndef GAME_MODEL_H
 #define GAME_MODEL_H
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 #include "app/model/enums/GameState.h"
+#include "app/model/enums/PlayerInput.h"
+#include "app/model/enums/StepEvent.h"
 #include "app/model/enums/Zone.h"
+#include "app/model/events/GameEventBuffer.h"
 #include "app/model/game-components/Bonus.h"
 #include "app/model/game-components/Coin.h"
+#include "app/model/game-components/ElementSweepIndex.h"
 #include "app/model/game-components/Enemy.h"
 #include "app/model/game-components/Player.h"
+#include "app/model/level/LevelGenerator.h"
+#include "app/model/replay/InputRecorder.h"
+#include "app/model/replay/InputReplay.h"
+#include "app/model/snapshot/GameSnapshot.h"
+#include "app/model/utils/CollisionUtils.h"
+#include "app/model/utils/RandomGenerator.h"
 #include "AbstractModel.h"
 
 /**
@@ -34,14 +48,41 @@ limitations under the License.
  * handling events like zone changing,
  * calculating final score, etc.
  *
+ * Elements data are kept in a fixed capacity structure of arrays (MovableElementStore),
+ * elements being accessed through lightweight views.
+ * Field elements are also indexed by x-position so that collision
+ * checks only handle nearby elements.
+ *
+ * The level is generated chunk by chunk ahead of the player, between steps,
+ * and its elements are streamed in as the field scrolls to them.
+ *
+ * The simulation runs at a fixed timestep, independently of the
+ * rendering frame rate: elapsed time is accumulated by nextStep()
+ * and consumed by as many fixed steps as needed.
+ * Headless runners can call simulateStep() directly to run
+ * as fast as possible, without wall-clock gating.
+ *
+ * All random choices of a game come from its own generator:
+ * a seed and the input of each step reproduce a game exactly.
+ * Changes applied from outside of steps (e.g. zone transitions handled by the view)
+ * are gathered as step events, so that they can be recorded and replayed
+ * on the same step as player inputs.
+ *
+ * Gameplay events (collected coins, collisions, despawned elements, ...)
+ * are published in a ring buffer which consumers drain at their own pace.
+ *
+ * The whole running game can be saved to a snapshot and restored later,
+ * e.g. to rewind it, to explore future steps or to resume it after a crash.
+ *
  * @author Arthur
- * @date 26/03/2016 - 13/01/2019
+ * @date 26/03/2016 - 17/10/2026
  */
 class GameModel: public AbstractModel
 {
 public:
     //=== CTORs / DTORs
     GameModel(float width, float height, AppCore* appCore);
+    GameModel(float width, float height, AppCore* appCore, std::uint64_t seed);
     ~GameModel() override;
 
     //=== GETTERS
@@ -51,12 +92,26 @@ public:
     Player* getPlayer() const;
     float getGameSpeed() const;
     Zone getCurrentZone() const;
-    const std::set<MovableElement*>& getNewMElementsArray() const;
+    const std::vector<ElementHandle>& getNewMElementsArray() const;
+    const std::vector<ElementRemoval>& getRemovedMElementsArray() const;
+    MovableElement getMovableElement(const ElementHandle& handle);
+    bool isMovableElementAlive(const ElementHandle& handle) const;
+    unsigned int getLiveElementsCount() const;
+    unsigned int getPooledElementsCount() const;
     int getBonusTimeout() const;
     unsigned int getGameFloorPosition() const;
     bool isTransitionRunning() const;
     bool isTransitionPossible() const;
     bool isMusicEnabled() const;
+    float getInterpolationFactor() const;
+    static int getSimulationRate();
+    unsigned long getStepCount() const;
+    float getNextEnemyDistance() const;
+    std::uint64_t getSeed() const;
+    RandomGenerator& getRandomGenerator();
+    ReplayHeader getReplayHeader() const;
+    bool isReplaying() const;
+    const GameEventBuffer& getEventBuffer() const;
 
     //=== SETTERS
     void setGameState(const GameState& state);
@@ -64,12 +119,21 @@ public:
     void setCurrentZone(const Zone& z);
     void disableTransitionPossibility();
     void toggleGameMusic();
+    void setPlayerInput(unsigned int input);
+    void requestPlayerDeceleration();
+    void setInputRecorder(InputRecorder* recorder);
+    void setInputReplay(InputReplay* replay);
 
     //=== METHODS
     void nextStep() override;
-    void moveMovableElement(MovableElement* element);
+    void simulateStep();
+    void endGame();
     void clearNewMovableElementList();
+    void clearRemovedMovableElementList();
     void saveCurrentGame();
+    void resolveActivatedItems();
+    void saveSnapshot(GameSnapshot& snapshot) const;
+    bool restoreSnapshot(GameSnapshot& snapshot);
 
 private:
     //=== ATTRIBUTES
@@ -80,29 +144,49 @@ private:
     float m_gameSpeed;
     float m_gameSlowSpeed;
     Zone m_currentZone;
-    int m_currentEnemySpawnDistance;
-    int m_currentCoinSpawnDistance;
-    int m_currentBonusSpawnDistance;
-    int m_nextEnemySpawnDistance;
-    int m_nextCoinSpawnDistance;
-    int m_nextBonusSpawnDistance;
     int m_scoreBonusFlattenedEnemies;
-    std::chrono::system_clock::time_point m_lastTime;
+    unsigned int m_playerInput;
+    bool m_isDecelerationRequested;
+    unsigned int m_pendingEvents;
+    GameState m_pausedGameState;
+    unsigned long m_stepCount;
+    std::chrono::steady_clock::time_point m_lastTime;
+    std::chrono::nanoseconds m_timeAccumulator;
     std::chrono::milliseconds m_bonusTimeout;
+    float m_stepDistance;
+    std::uint32_t m_fieldDistance;
+    unsigned int m_activatedItems;
+    RandomGenerator m_randomGenerator;
+    LevelGenerator m_levelGenerator;
+    InputRecorder* m_inputRecorder;
+    InputReplay* m_inputReplay;
     Player* m_player;
 
     //Containers
-    std::set<MovableElement*> m_movableElementsArray;
-    std::set<MovableElement*> m_newMovableElementsArray;
+    MovableElementStore m_elementStore;
+    ElementSweepIndex m_sweepIndex;
+    std::vector<std::size_t> m_nearbyElementsArray;
+    BoundingBoxBatch m_nearbyBoxes;
+    std::vector<std::uint32_t> m_hitMask;
+    std::vector<ElementHandle> m_newMovableElementsArray;
+    std::vector<ElementRemoval> m_removedMovableElementsArray;
+    std::vector<ElementRemoval> m_viewElementsArray;
+    GameEventBuffer m_eventBuffer;
+    GameSnapshot m_rollbackSnapshot;
 
     //Constants
+    static constexpr int MAX_MOVABLE_ELEMENTS = 256;
+    static constexpr int EVENT_BUFFER_CAPACITY = 256;
     const int DEFAULT_PLAYER_X = 50;
     const int ELEMENT_SIZE = 30;
     const int ITEM_SIZE = 25;
-    const int ELEMENT_MOVE_Y = 0;
-    const int SPEED_LIMIT = 20;
+    const float ELEMENT_MOVE_X = -1;
+    static constexpr int SPEED_LIMIT = 20;
     const int NEXT_STEP_DELAY = 100;
+    static constexpr int SIMULATION_RATE = 30;
+    const int MAX_STEPS_PER_FRAME = 5;
     const int ZONE_CHANGING_DISTANCE = 500;
+    const int LEVEL_LOOKAHEAD = 1024;
     const int MEGA_TIMEOUT = 10000;
     const int FLY_TIMEOUT = 15000;
     const int SLOW_SPEED_TIMEOUT = 20000;
@@ -120,7 +204,11 @@ private:
     const int SPEED_DISTANCE_RATIO = 5;
 
     //=== PRIVATE METHODS
+    void applyPlayerInput(unsigned int input);
+    void applyStepEvents(unsigned int events);
+    void moveMovableElements();
     void handleSpeedAndDistance();
+    void handleLevelGeneration();
     void handleMovableElementsCreation();
     void handleMovableElementsCollisions();
     void handleMovableElementsDeletion();
@@ -130,8 +218,11 @@ private:
     void handleBonusTimeout();
     void conditionallyAllowZoneTransition();
     void conditionallyTriggerGameOver();
-    bool checkIfPositionFree(float x, float y) const;
     void addANewMovableElement(float posX, float posY, int type);
+    void publishEvent(const GameEventType& type, const MovableElementType& elementType, const ElementHandle& handle);
+    bool readSnapshot(GameSnapshot& snapshot);
+    void collectViewElements();
+    void notifyRestoredElements();
 };
 
 #endif
@@ -85,12 +85,12 @@ void SettingsModel::changePlayerSkin(const string& skin)
 /**
  * Checks all customization items availability
  * @author Arthur
- * @date 21/05/16 - 31/10/17
+ * @date 21/05/16 - 17/10/2026
  */
 void SettingsModel::checkItemsAvailability()
 {
-    m_morphBallSkinIsAvailable = m_appCore->findActivatedItem("shop_morphball_skin");
-    m_pokeballSkinIsAvailable = m_appCore->findActivatedItem("shop_pokeball_skin");
+    m_morphBallSkinIsAvailable = m_appCore->isItemActivated(SHOP_MORPHBALL_SKIN);
+    m_pokeballSkinIsAvailable = m_appCore->isItemActivated(SHOP_POKEBALL_SKIN);
 }
 
 
@@ -1,4 +1,5 @@
 #include "ShopModel.h"
+#include "libs/Logger/Tracer.h"
 
 using std::string;
 using std::stoi;
@@ -50,10 +51,11 @@ vector<ShopItem*> ShopModel::getShopItemsArray() const { return m_appCore->getSh
  * @param item the item to buy
  *
  * @author Arthur
- * @date 11/05/16 - 04/01/17
+ * @date 11/05/16 - 17/10/2026
  */
 bool ShopModel::buyItem(ShopItem* item)
 {
+    TRACE_SCOPE("model", "ShopModel::buyItem");
     if (!item->isBought() && item->getPrice() <= m_appCore->getWallet()) {
         //=== update objects
 
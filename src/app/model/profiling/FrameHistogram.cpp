@@ -0,0 +1,129 @@
+#include "FrameHistogram.h"
+
+#include <algorithm>
+
+constexpr unsigned int FrameHistogram::SUB_BUCKET_BITS;
+constexpr unsigned int FrameHistogram::SUB_BUCKET_COUNT;
+constexpr unsigned int FrameHistogram::MAX_EXPONENT;
+constexpr unsigned int FrameHistogram::BUCKET_COUNT;
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs an empty histogram
+ * @author Arthur
+ * @date 17/10/2026
+ */
+FrameHistogram::FrameHistogram() : m_buckets{}, m_count{0}, m_max{0}
+{}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::uint64_t FrameHistogram::getCount() const { return m_count; }
+
+std::uint32_t FrameHistogram::getMax() const { return m_max; }
+
+/**
+ * @brief Get the duration below which a percentage of recorded durations are
+ *
+ * @param percent the percentage, from 0 to 100
+ * @return the duration in microseconds, the middle of its bucket, 0 without durations
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::uint32_t FrameHistogram::getPercentile(unsigned int percent) const
+{
+    if (m_count == 0) {
+        return 0;
+    } else if (percent >= 100) {
+        return m_max;
+    }
+
+    const std::uint64_t rank = std::max<std::uint64_t>(1, (m_count * percent + 99) / 100);
+    std::uint64_t count = 0;
+
+    for (unsigned int bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+        count += m_buckets[bucket];
+        if (count >= rank) {
+            return std::min(getBucketValue(bucket), m_max);
+        }
+    }
+
+    return m_max;
+}
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+void FrameHistogram::record(std::uint32_t microseconds)
+{
+    m_buckets[findBucket(microseconds)]++;
+    m_count++;
+    m_max = std::max(m_max, microseconds);
+}
+
+void FrameHistogram::clear()
+{
+    std::fill(m_buckets, m_buckets + BUCKET_COUNT, 0);
+    m_count = 0;
+    m_max = 0;
+}
+
+/**
+ * @brief Find the bucket of a duration
+ * @details For a duration with its highest bit at position e (e >= 4),
+ * the bucket is found from e and the 4 bits following the highest one
+ *
+ * @param microseconds the duration
+ * @return the bucket index
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+unsigned int FrameHistogram::findBucket(std::uint32_t microseconds)
+{
+    if (microseconds < SUB_BUCKET_COUNT) {
+        return microseconds;
+    }
+
+    unsigned int exponent = SUB_BUCKET_BITS;
+    while (exponent < MAX_EXPONENT && (microseconds >> (exponent + 1)) != 0) {
+        exponent++;
+    }
+    if ((microseconds >> (exponent + 1)) != 0) {
+        return BUCKET_COUNT - 1;
+    }
+
+    const unsigned int subBucket = (microseconds >> (exponent - SUB_BUCKET_BITS)) - SUB_BUCKET_COUNT;
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+/**
+ * @brief Get the duration representing a bucket
+ *
+ * @param bucket the bucket index
+ * @return the middle of the bucket's range in microseconds
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::uint32_t FrameHistogram::getBucketValue(unsigned int bucket)
+{
+    if (bucket < SUB_BUCKET_COUNT) {
+        return bucket;
+    }
+
+    const unsigned int exponent = bucket / SUB_BUCKET_COUNT - 1 + SUB_BUCKET_BITS;
+    const unsigned int shift = exponent - SUB_BUCKET_BITS;
+    const std::uint32_t lowerBound = (SUB_BUCKET_COUNT + bucket % SUB_BUCKET_COUNT) << shift;
+
+    return lowerBound + ((1u << shift) >> 1);
+}
@@ -0,0 +1,62 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef FRAME_HISTOGRAM_H
+#define FRAME_HISTOGRAM_H
+
+#include <cstdint>
+
+/**
+ * @class FrameHistogram
+ * @details Fixed-size histogram of durations in microseconds.
+ * Durations below 16 µs have their own bucket, and each next
+ * power of two range is split in 16 buckets, so that a percentile
+ * is known within about 6% without storing samples.
+ * Durations above about one second share the last bucket.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class FrameHistogram
+{
+public:
+    //=== CTORs / DTORs
+    FrameHistogram();
+
+    //=== GETTERS
+    std::uint64_t getCount() const;
+    std::uint32_t getMax() const;
+    std::uint32_t getPercentile(unsigned int percent) const;
+
+    //=== METHODS
+    void record(std::uint32_t microseconds);
+    void clear();
+
+    static unsigned int findBucket(std::uint32_t microseconds);
+    static std::uint32_t getBucketValue(unsigned int bucket);
+
+private:
+    //=== ATTRIBUTES
+    static constexpr unsigned int SUB_BUCKET_BITS = 4;
+    static constexpr unsigned int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr unsigned int MAX_EXPONENT = 20;
+    static constexpr unsigned int BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT;
+
+    std::uint32_t m_buckets[BUCKET_COUNT];
+    std::uint64_t m_count;
+    std::uint32_t m_max;
+};
+
+#endif
@@ -0,0 +1,218 @@
+#include "FrameProfiler.h"
+
+#include <algorithm>
+#include <limits>
+#include "libs/Logger/Logger.h"
+
+using Bokoblin::SimpleLogger::Logger;
+using std::chrono::steady_clock;
+
+namespace
+{
+const char* const PHASE_NAMES[FRAME_PHASE_COUNT] = {
+        "frame", "handle_events", "next_step", "synchronize", "draw",
+        "link_elements", "update_elements", "draw_running_game", "display"
+};
+}
+
+constexpr std::size_t FrameProfiler::RECENT_FRAME_COUNT;
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs a frame profiler
+ *
+ * @param frameBudget the duration a frame shouldn't exceed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+FrameProfiler::FrameProfiler(std::chrono::microseconds frameBudget) :
+        m_frameBudget{static_cast<std::uint32_t>(frameBudget.count())}, m_frameDurations{},
+        m_lastDurations{}, m_recentFrameDurations{}, m_frameCount{0}, m_overBudgetCount{0}
+{}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+const FrameHistogram& FrameProfiler::getHistogram(const FramePhase& phase) const { return m_histograms[phase]; }
+
+std::uint64_t FrameProfiler::getFrameCount() const { return m_frameCount; }
+
+std::uint64_t FrameProfiler::getOverBudgetCount() const { return m_overBudgetCount; }
+
+std::uint32_t FrameProfiler::getFrameBudget() const { return m_frameBudget; }
+
+std::uint32_t FrameProfiler::getLastDuration(const FramePhase& phase) const { return m_lastDurations[phase]; }
+
+/**
+ * @brief Get the duration of a recent frame
+ *
+ * @param age the number of frames ended since, 0 for the last one
+ * @return the duration in microseconds, 0 if there is no such frame
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::uint32_t FrameProfiler::getRecentFrameDuration(std::size_t age) const
+{
+    if (age >= RECENT_FRAME_COUNT || age >= m_frameCount) {
+        return 0;
+    }
+    return m_recentFrameDurations[(m_frameCount - 1 - age) % RECENT_FRAME_COUNT];
+}
+
+const char* FrameProfiler::getPhaseName(const FramePhase& phase) { return PHASE_NAMES[phase]; }
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Start streaming frame durations to a CSV file
+ *
+ * @param path the file's path, overwritten
+ * @return false if the file can't be written
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool FrameProfiler::openCsv(const std::string& path)
+{
+    m_csvFile.open(path, std::ios::out | std::ios::trunc);
+    if (!m_csvFile) {
+        Logger::printError("Frame timings file couldn't be created: ", path);
+        return false;
+    }
+
+    m_csvFile << "frame_index";
+    for (const char* phaseName : PHASE_NAMES) {
+        m_csvFile << ',' << phaseName << "_us";
+    }
+    m_csvFile << '\n';
+
+    return true;
+}
+
+/**
+ * @brief Start measuring a frame
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void FrameProfiler::beginFrame()
+{
+    std::fill(m_frameDurations, m_frameDurations + FRAME_PHASE_COUNT, 0);
+    m_frameStart = steady_clock::now();
+}
+
+/**
+ * @brief End measuring a frame
+ * @details The frame's duration is recorded, its durations are kept as the last ones,
+ * and the frame's row is written to the CSV file if any
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void FrameProfiler::endFrame()
+{
+    record(PHASE_FRAME, steady_clock::now() - m_frameStart);
+    if (m_frameDurations[PHASE_FRAME] > m_frameBudget) {
+        m_overBudgetCount++;
+    }
+
+    std::copy(m_frameDurations, m_frameDurations + FRAME_PHASE_COUNT, m_lastDurations);
+    m_recentFrameDurations[m_frameCount % RECENT_FRAME_COUNT] = m_frameDurations[PHASE_FRAME];
+
+    if (m_csvFile.is_open()) {
+        m_csvFile << m_frameCount;
+        for (std::uint32_t duration : m_frameDurations) {
+            m_csvFile << ',' << duration;
+        }
+        m_csvFile << '\n';
+    }
+
+    m_frameCount++;
+}
+
+/**
+ * @brief Record the duration of a phase in the current frame
+ *
+ * @param phase the phase
+ * @param duration the phase's duration
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void FrameProfiler::record(const FramePhase& phase, steady_clock::duration duration)
+{
+    const auto microseconds = static_cast<std::uint32_t>(std::min<std::int64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(duration).count(),
+            std::numeric_limits<std::uint32_t>::max()));
+
+    m_histograms[phase].record(microseconds);
+    m_frameDurations[phase] += microseconds;
+}
+
+/**
+ * @brief Log the percentiles of each measured phase, in microseconds
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void FrameProfiler::logReport() const
+{
+    if (m_frameCount == 0) {
+        return;
+    }
+
+    Logger::printInfo("Frame timings: ", m_frameCount, " frames, ", m_overBudgetCount,
+                      " over the budget of ", m_frameBudget, " us");
+
+    for (int phase = 0; phase < FRAME_PHASE_COUNT; phase++) {
+        const FrameHistogram& histogram = m_histograms[phase];
+        if (histogram.getCount() > 0) {
+            Logger::printInfo("  ", PHASE_NAMES[phase], ": p50 ", histogram.getPercentile(50),
+                              " us, p95 ", histogram.getPercentile(95),
+                              " us, p99 ", histogram.getPercentile(99),
+                              " us, max ", histogram.getMax(), " us");
+        }
+    }
+}
+
+
+//------------------------------------------------
+//          PHASE TIMER
+//------------------------------------------------
+
+/**
+ * Constructs a phase timer, starting the measure
+ *
+ * @param profiler the profiler recording the phase, nullptr to measure nothing
+ * @param phase the measured phase
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+PhaseTimer::PhaseTimer(FrameProfiler* profiler, const FramePhase& phase) :
+        m_profiler{profiler}, m_phase{phase}
+{
+    if (m_profiler != nullptr) {
+        m_start = steady_clock::now();
+    }
+}
+
+/**
+ * Destructor, recording the phase's duration
+ * @author Arthur
+ * @date 17/10/2026
+ */
+PhaseTimer::~PhaseTimer()
+{
+    if (m_profiler != nullptr) {
+        m_profiler->record(m_phase, steady_clock::now() - m_start);
+    }
+}
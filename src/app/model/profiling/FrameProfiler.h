@@ -0,0 +1,104 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include "app/model/enums/FramePhase.h"
+#include "FrameHistogram.h"
+
+/**
+ * @class FrameProfiler
+ * @details Measure the duration of each frame phase.
+ * Durations are recorded in a histogram per phase, whose percentiles
+ * are logged by logReport(), typically on exit.
+ * Optionally, the durations of each frame are also streamed to a CSV file,
+ * a row per frame with a column per phase (0 for phases not run in the frame).
+ * The durations of the last frame and the total durations of recent frames
+ * are kept for on-screen display.
+ *
+ * Phases are timed with a PhaseTimer, a null profiler disabling it.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class FrameProfiler
+{
+public:
+    //=== CTORs / DTORs
+    explicit FrameProfiler(std::chrono::microseconds frameBudget);
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    //=== ATTRIBUTES
+    static constexpr std::size_t RECENT_FRAME_COUNT = 120;
+
+    //=== GETTERS
+    const FrameHistogram& getHistogram(const FramePhase& phase) const;
+    std::uint64_t getFrameCount() const;
+    std::uint64_t getOverBudgetCount() const;
+    std::uint32_t getFrameBudget() const;
+    std::uint32_t getLastDuration(const FramePhase& phase) const;
+    std::uint32_t getRecentFrameDuration(std::size_t age) const;
+    static const char* getPhaseName(const FramePhase& phase);
+
+    //=== METHODS
+    bool openCsv(const std::string& path);
+    void beginFrame();
+    void endFrame();
+    void record(const FramePhase& phase, std::chrono::steady_clock::duration duration);
+    void logReport() const;
+
+private:
+    //=== ATTRIBUTES
+    const std::uint32_t m_frameBudget;
+    FrameHistogram m_histograms[FRAME_PHASE_COUNT];
+    std::uint32_t m_frameDurations[FRAME_PHASE_COUNT];
+    std::uint32_t m_lastDurations[FRAME_PHASE_COUNT];
+    std::uint32_t m_recentFrameDurations[RECENT_FRAME_COUNT];
+    std::chrono::steady_clock::time_point m_frameStart;
+    std::uint64_t m_frameCount;
+    std::uint64_t m_overBudgetCount;
+    std::ofstream m_csvFile;
+};
+
+
+/**
+ * @class PhaseTimer
+ * @details Record the duration of its scope as a frame phase
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class PhaseTimer
+{
+public:
+    //=== CTORs / DTORs
+    PhaseTimer(FrameProfiler* profiler, const FramePhase& phase);
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+    ~PhaseTimer();
+
+private:
+    //=== ATTRIBUTES
+    FrameProfiler* m_profiler;
+    const FramePhase m_phase;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include "InputRecorder.h"
+
+using std::string;
+using Bokoblin::SimpleLogger::Logger;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+InputRecorder::InputRecorder() : m_runValue{0}, m_runLength{0}, m_stepCount{0}
+{}
+
+/**
+ * @brief Destructor, completing the recording
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+InputRecorder::~InputRecorder()
+{
+    close();
+}
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+bool InputRecorder::isOpen() const { return m_file.is_open(); }
+unsigned long InputRecorder::getStepCount() const { return m_stepCount; }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Start a new recording, replacing any existing file
+ *
+ * @param path the recording file path
+ * @param header the header of the recorded game
+ * @return true if the recording was started
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool InputRecorder::open(const string& path, const ReplayHeader& header)
+{
+    close();
+
+    m_file.open(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open() || !ReplayFormat::writeHeader(m_file, header)) {
+        Logger::printError("Input recording couldn't be started: ", path);
+        m_file.close();
+        return false;
+    }
+
+    m_runValue = 0;
+    m_runLength = 0;
+    m_stepCount = 0;
+    Logger::printInfo("Input recording started: ", path);
+    return true;
+}
+
+/**
+ * @brief Record the input and events of a simulation step
+ *
+ * @param input the step's PlayerInput flags
+ * @param events the step's StepEvent flags
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void InputRecorder::recordStep(unsigned int input, unsigned int events)
+{
+    if (!m_file.is_open()) {
+        return;
+    }
+
+    const unsigned int value = input | (events << ReplayFormat::EVENTS_SHIFT);
+    if (m_runLength != 0 && value != m_runValue) {
+        appendRun();
+    }
+
+    m_runValue = value;
+    m_runLength++;
+    m_stepCount++;
+}
+
+/**
+ * @brief Append the last run and complete the recording
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void InputRecorder::close()
+{
+    if (m_file.is_open()) {
+        appendRun();
+        m_file.close();
+    }
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Append the current run to the file
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void InputRecorder::appendRun()
+{
+    if (m_runLength != 0) {
+        ReplayFormat::writeVarint(m_file, m_runValue);
+        ReplayFormat::writeVarint(m_file, m_runLength);
+        m_runLength = 0;
+    }
+}
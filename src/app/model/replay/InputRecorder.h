@@ -0,0 +1,63 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include <fstream>
+#include "libs/Logger/Logger.h"
+#include "ReplayFormat.h"
+
+/**
+ * @class InputRecorder
+ * @details Record the input and events of each simulation step of a game
+ * into an append-only binary file, starting with a header holding the game's seed. \n
+ * Identical consecutive steps are grouped in runs, a run being appended
+ * as soon as the step value changes, so a recording is a few bytes per second of play.
+ *
+ * @see ReplayFormat
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class InputRecorder
+{
+public:
+    //=== CTORs / DTORs
+    InputRecorder();
+    InputRecorder(const InputRecorder&) = delete;
+    ~InputRecorder();
+
+    //=== GETTERS
+    bool isOpen() const;
+    unsigned long getStepCount() const;
+
+    //=== METHODS
+    bool open(const std::string& path, const ReplayHeader& header);
+    void recordStep(unsigned int input, unsigned int events);
+    void close();
+
+private:
+    //=== ATTRIBUTES
+    std::ofstream m_file;
+    unsigned int m_runValue;
+    unsigned long m_runLength;
+    unsigned long m_stepCount;
+
+    //=== PRIVATE METHODS
+    void appendRun();
+};
+
+#endif
@@ -0,0 +1,119 @@
+#include "InputReplay.h"
+
+using std::string;
+using Bokoblin::SimpleLogger::Logger;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+InputReplay::InputReplay() : m_header(), m_stepCount{0}, m_currentRun{0}, m_currentRunStep{0}
+{}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+InputReplay::~InputReplay() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+const ReplayHeader& InputReplay::getHeader() const { return m_header; }
+unsigned long InputReplay::getStepCount() const { return m_stepCount; }
+bool InputReplay::isFinished() const { return m_currentRun >= m_runValues.size(); }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Load a whole recording in memory
+ *
+ * @param path the recording file path
+ * @return true if the recording is valid
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool InputReplay::load(const string& path)
+{
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+
+    m_runValues.clear();
+    m_runLengths.clear();
+    m_stepCount = 0;
+    rewind();
+
+    if (!file.is_open() || !ReplayFormat::readHeader(file, m_header)) {
+        Logger::printError("Invalid input recording: ", path);
+        return false;
+    }
+
+    std::uint64_t value, length;
+    while (ReplayFormat::readVarint(file, value)) {
+        if (!ReplayFormat::readVarint(file, length)) {
+            Logger::printWarning("Truncated input recording: ", path);
+            break;
+        }
+        m_runValues.push_back(static_cast<unsigned int>(value));
+        m_runLengths.push_back(static_cast<unsigned long>(length));
+        m_stepCount += length;
+    }
+
+    Logger::printInfo("Input recording loaded: ", path, " (", m_stepCount, " steps)");
+    return true;
+}
+
+/**
+ * @brief Provide the input and events of the next step
+ *
+ * @param input the step's PlayerInput flags
+ * @param events the step's StepEvent flags
+ * @return false if all recorded steps were already provided
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool InputReplay::readNextStep(unsigned int& input, unsigned int& events)
+{
+    while (m_currentRun < m_runValues.size() && m_currentRunStep >= m_runLengths[m_currentRun]) {
+        m_currentRun++;
+        m_currentRunStep = 0;
+    }
+
+    if (isFinished()) {
+        return false;
+    }
+
+    const unsigned int value = m_runValues[m_currentRun];
+    input = value & ((1u << ReplayFormat::EVENTS_SHIFT) - 1);
+    events = value >> ReplayFormat::EVENTS_SHIFT;
+
+    if (++m_currentRunStep >= m_runLengths[m_currentRun]) {
+        m_currentRun++;
+        m_currentRunStep = 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Restart the replay from its first step
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void InputReplay::rewind()
+{
+    m_currentRun = 0;
+    m_currentRunStep = 0;
+}
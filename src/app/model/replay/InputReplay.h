@@ -0,0 +1,60 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef INPUT_REPLAY_H
+#define INPUT_REPLAY_H
+
+#include <fstream>
+#include "libs/Logger/Logger.h"
+#include "ReplayFormat.h"
+
+/**
+ * @class InputReplay
+ * @details Load a recording made by InputRecorder,
+ * providing the input and events of each simulation step in order.
+ *
+ * @see ReplayFormat
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class InputReplay
+{
+public:
+    //=== CTORs / DTORs
+    InputReplay();
+    ~InputReplay();
+
+    //=== GETTERS
+    const ReplayHeader& getHeader() const;
+    unsigned long getStepCount() const;
+    bool isFinished() const;
+
+    //=== METHODS
+    bool load(const std::string& path);
+    bool readNextStep(unsigned int& input, unsigned int& events);
+    void rewind();
+
+private:
+    //=== ATTRIBUTES
+    ReplayHeader m_header;
+    std::vector<unsigned int> m_runValues;
+    std::vector<unsigned long> m_runLengths;
+    unsigned long m_stepCount;
+    std::size_t m_currentRun;
+    unsigned long m_currentRunStep;
+};
+
+#endif
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include "ReplayFormat.h"
+
+using std::string;
+
+constexpr std::uint16_t ReplayFormat::VERSION;
+constexpr unsigned int ReplayFormat::EVENTS_SHIFT;
+
+namespace
+{
+const char MAGIC[] = {'B', 'K', 'R', 'I'};
+const unsigned int MAX_VARINT_BYTES = 10;
+}
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Write a replay header
+ *
+ * @param stream the binary stream to write to
+ * @param header the header to write
+ * @return true if the header was written
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool ReplayFormat::writeHeader(std::ostream& stream, const ReplayHeader& header)
+{
+    if (header.activatedItems.size() > UINT8_MAX) {
+        return false;
+    }
+
+    stream.write(MAGIC, sizeof(MAGIC));
+    writeInteger(stream, VERSION, 2);
+    writeInteger(stream, header.seed, 8);
+    writeInteger(stream, static_cast<std::uint64_t>(header.difficulty), 1);
+    writeInteger(stream, header.width, 4);
+    writeInteger(stream, header.height, 4);
+    writeInteger(stream, header.activatedItems.size(), 1);
+
+    for (const string& item : header.activatedItems) {
+        const std::size_t length = std::min<std::size_t>(item.size(), UINT8_MAX);
+        writeInteger(stream, length, 1);
+        stream.write(item.data(), static_cast<std::streamsize>(length));
+    }
+
+    return stream.good();
+}
+
+/**
+ * @brief Read a replay header, checking its magic and version
+ *
+ * @param stream the binary stream to read from
+ * @param header the header to fill
+ * @return true if a valid header was read
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool ReplayFormat::readHeader(std::istream& stream, ReplayHeader& header)
+{
+    char magic[sizeof(MAGIC)];
+    std::uint64_t version, difficulty, width, height, itemCount;
+
+    if (!stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)
+            || !readInteger(stream, version, 2) || version != VERSION
+            || !readInteger(stream, header.seed, 8)
+            || !readInteger(stream, difficulty, 1)
+            || !readInteger(stream, width, 4)
+            || !readInteger(stream, height, 4)
+            || !readInteger(stream, itemCount, 1)) {
+        return false;
+    }
+
+    header.difficulty = static_cast<int>(difficulty);
+    header.width = static_cast<unsigned int>(width);
+    header.height = static_cast<unsigned int>(height);
+    header.activatedItems.clear();
+
+    for (std::uint64_t i = 0; i < itemCount; i++) {
+        std::uint64_t length;
+        if (!readInteger(stream, length, 1)) {
+            return false;
+        }
+
+        string item(length, '\0');
+        if (!stream.read(&item[0], static_cast<std::streamsize>(length))) {
+            return false;
+        }
+        header.activatedItems.push_back(item);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Write an unsigned integer using as few bytes as possible
+ *
+ * @param stream the binary stream to write to
+ * @param value the value to write
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ReplayFormat::writeVarint(std::ostream& stream, std::uint64_t value)
+{
+    while (value >= 0x80) {
+        stream.put(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    stream.put(static_cast<char>(value));
+}
+
+/**
+ * @brief Read an unsigned integer written by writeVarint()
+ *
+ * @param stream the binary stream to read from
+ * @param value the read value
+ * @return true if a complete value was read
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool ReplayFormat::readVarint(std::istream& stream, std::uint64_t& value)
+{
+    value = 0;
+
+    for (unsigned int i = 0; i < MAX_VARINT_BYTES; i++) {
+        const int byte = stream.get();
+        if (byte == std::char_traits<char>::eof()) {
+            return false;
+        }
+
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Write the given number of bytes of an integer, little endian
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void ReplayFormat::writeInteger(std::ostream& stream, std::uint64_t value, unsigned int byteCount)
+{
+    for (unsigned int i = 0; i < byteCount; i++) {
+        stream.put(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+/**
+ * @brief Read the given number of bytes of an integer, little endian
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool ReplayFormat::readInteger(std::istream& stream, std::uint64_t& value, unsigned int byteCount)
+{
+    value = 0;
+
+    for (unsigned int i = 0; i < byteCount; i++) {
+        const int byte = stream.get();
+        if (byte == std::char_traits<char>::eof()) {
+            return false;
+        }
+        value |= static_cast<std::uint64_t>(byte) << (8 * i);
+    }
+
+    return true;
+}
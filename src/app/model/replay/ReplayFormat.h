@@ -0,0 +1,76 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef REPLAY_FORMAT_H
+#define REPLAY_FORMAT_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ReplayHeader
+ * @details Values needed to start a game again exactly as it was recorded
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct ReplayHeader
+{
+    std::uint64_t seed;
+    int difficulty;
+    unsigned int width;
+    unsigned int height;
+    std::vector<std::string> activatedItems;
+};
+
+/**
+ * @class ReplayFormat
+ * @details Read and write the binary replay format, all values being little endian: \n
+ * - header: "BKRI" magic, version (16 bits), seed (64 bits), difficulty (8 bits),
+ *   width and height (32 bits), activated items count (8 bits) then each item
+ *   as its length (8 bits) followed by its characters \n
+ * - body: runs of identical steps, each run being the step value
+ *   (player input flags, and step event flags shifted by 8 bits) followed by the run length,
+ *   both encoded as variable length integers (7 bits per byte).
+ *
+ * The version must be increased whenever the simulation changes in a way
+ * that makes previous recordings diverge.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class ReplayFormat
+{
+public:
+    //=== METHODS
+    static bool writeHeader(std::ostream& stream, const ReplayHeader& header);
+    static bool readHeader(std::istream& stream, ReplayHeader& header);
+    static void writeVarint(std::ostream& stream, std::uint64_t value);
+    static bool readVarint(std::istream& stream, std::uint64_t& value);
+
+    //=== CONSTANTS
+    static constexpr std::uint16_t VERSION = 3;
+    static constexpr unsigned int EVENTS_SHIFT = 8;
+
+private:
+    //=== METHODS
+    static void writeInteger(std::ostream& stream, std::uint64_t value, unsigned int byteCount);
+    static bool readInteger(std::istream& stream, std::uint64_t& value, unsigned int byteCount);
+};
+
+#endif
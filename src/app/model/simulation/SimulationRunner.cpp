@@ -0,0 +1,320 @@
+#include "SimulationRunner.h"
+
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::endl;
+using std::string;
+using std::vector;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ *
+ * @param width the game's width
+ * @param height the game's height
+ * @param input the input policy driving the player
+ * @param maxSteps the maximum number of steps of a game, 0 for no limit
+ * @param threadCount the number of worker threads, at least one
+ * @param seed the seed of the first game, next games using the following seeds
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+SimulationRunner::SimulationRunner(float width, float height, const SimulationInput& input,
+                                   unsigned long maxSteps, unsigned int threadCount, std::uint64_t seed) :
+        m_width{width}, m_height{height}, m_input{input}, m_maxSteps{maxSteps},
+        m_threadCount{std::max(threadCount, 1u)}, m_seed{seed}, m_elapsedTime{0}
+{}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+SimulationRunner::~SimulationRunner() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+const vector<SimulationResult>& SimulationRunner::getResults() const { return m_results; }
+
+unsigned long SimulationRunner::getTotalSteps() const
+{
+    unsigned long totalSteps = 0;
+    for (const SimulationResult& result : m_results) {
+        totalSteps += result.steps;
+    }
+    return totalSteps;
+}
+
+double SimulationRunner::getElapsedSeconds() const { return duration<double>(m_elapsedTime).count(); }
+unsigned int SimulationRunner::getThreadCount() const { return m_threadCount; }
+std::uint64_t SimulationRunner::getSeed() const { return m_seed; }
+
+//------------------------------------------------
+//          SETTERS
+//------------------------------------------------
+
+/**
+ * @brief Set the file where the first game of the next run is recorded
+ * @details The path is cleared once the game is recorded
+ *
+ * @param path the recording's path, empty for no recording
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::setRecordPath(const string& path) { m_recordPath = path; }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Run a given number of complete games on the worker threads
+ * @details Results are added to the ones of previous runs, in game order
+ *
+ * @param gameCount the number of games to run
+ * @param difficulty the difficulty of the games
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::run(unsigned int gameCount, const Difficulty& difficulty)
+{
+    const std::size_t firstResult = m_results.size();
+    const unsigned int workerCount = std::min(m_threadCount, std::max(gameCount, 1u));
+    std::atomic<unsigned int> nextGame(0);
+    vector<std::thread> workers;
+
+    m_results.resize(firstResult + gameCount);
+    const steady_clock::time_point start = steady_clock::now();
+
+    for (unsigned int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&SimulationRunner::runWorker, this, firstResult, gameCount, difficulty, &nextGame);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    m_recordPath.clear();
+    m_elapsedTime += duration_cast<nanoseconds>(steady_clock::now() - start);
+}
+
+/**
+ * @brief Clear results and elapsed time of previous runs
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::clearResults()
+{
+    m_results.clear();
+    m_elapsedTime = nanoseconds(0);
+}
+
+/**
+ * @brief Print the throughput of the simulation and the distributions of game results
+ *
+ * @param output the stream to print to
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::printReport(std::ostream& output) const
+{
+    if (m_results.empty()) {
+        output << "No game simulated" << endl;
+        return;
+    }
+
+    const unsigned long totalSteps = getTotalSteps();
+    const double elapsedSeconds = std::max(getElapsedSeconds(), 1e-9);
+    const double simulatedSeconds = static_cast<double>(totalSteps) / GameModel::getSimulationRate();
+
+    vector<int> scores, distances, coins, enemyHits, bonuses;
+    for (const SimulationResult& result : m_results) {
+        scores.push_back(result.score);
+        distances.push_back(result.distance);
+        coins.push_back(result.coins);
+        enemyHits.push_back(result.enemyHits);
+        bonuses.push_back(result.bonuses);
+    }
+
+    output << "Games: " << m_results.size() << ", steps: " << totalSteps << ", threads: " << m_threadCount
+           << ", seeds: " << m_seed << "-" << m_seed + m_results.size() - 1
+           << ", wall time: " << elapsedSeconds << " s" << endl;
+    output << "Throughput: " << simulatedSeconds / elapsedSeconds << " simulated s/s, "
+           << totalSteps / elapsedSeconds << " steps/s, "
+           << m_results.size() / elapsedSeconds << " games/s" << endl;
+    printDistribution(output, "Score", scores);
+    printDistribution(output, "Distance", distances);
+    printDistribution(output, "Coins", coins);
+    printDistribution(output, "Enemy hits", enemyHits);
+    printDistribution(output, "Bonuses", bonuses);
+}
+
+//------------------------------------------------
+//          PRIVATE METHODS
+//------------------------------------------------
+
+/**
+ * @brief Run games on the calling thread until all games of the run are taken
+ * @details The worker binds its own AppCore to the thread persistence context,
+ * each result being written to its own slot
+ *
+ * @param firstResult the index of the first result of the run
+ * @param gameCount the number of games of the run
+ * @param difficulty the difficulty of the games
+ * @param nextGame the shared index of the next game to run
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::runWorker(std::size_t firstResult, unsigned int gameCount,
+                                 const Difficulty& difficulty, std::atomic<unsigned int>* nextGame)
+{
+    AppCore appCore;
+    PersistenceManager::initContext(appCore);
+    appCore.setDifficulty(difficulty);
+
+    unsigned int gameIndex = nextGame->fetch_add(1);
+    while (gameIndex < gameCount) {
+        m_results[firstResult + gameIndex] = runGame(appCore, m_seed + gameIndex,
+                                                     gameIndex == 0 ? m_recordPath : string());
+        gameIndex = nextGame->fetch_add(1);
+    }
+
+    PersistenceManager::closeContext();
+}
+
+/**
+ * @brief Run a complete game, until game over or step limit
+ *
+ * @param appCore the worker's app core
+ * @param seed the game's seed
+ * @param recordPath the file where the game is recorded, empty for no recording
+ * @return the game's result
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+SimulationResult SimulationRunner::runGame(AppCore& appCore, std::uint64_t seed, const string& recordPath) const
+{
+    GameModel gameModel(m_width, m_height, &appCore, seed);
+    RandomGenerator inputGenerator(seed, INPUT_STREAM);
+    InputRecorder inputRecorder;
+    GameEventCursor eventCursor = gameModel.getEventBuffer().createCursor();
+    GameEvent event;
+    int enemyHits = 0, bonuses = 0;
+
+    if (!recordPath.empty() && inputRecorder.open(recordPath, gameModel.getReplayHeader())) {
+        gameModel.setInputRecorder(&inputRecorder);
+    }
+
+    while (gameModel.getGameState() == RUNNING || gameModel.getGameState() == RUNNING_SLOWLY) {
+        if (m_maxSteps != 0 && gameModel.getStepCount() >= m_maxSteps) {
+            gameModel.endGame();
+            break;
+        }
+
+        emulateZoneTransition(gameModel);
+        gameModel.setPlayerInput(chooseInput(gameModel, inputGenerator));
+        gameModel.simulateStep();
+        gameModel.clearNewMovableElementList();
+        gameModel.clearRemovedMovableElementList();
+
+        while (gameModel.getEventBuffer().poll(eventCursor, event)) {
+            if (event.type == ENEMY_HIT) {
+                enemyHits++;
+            } else if (event.type == BONUS_ACTIVATED) {
+                bonuses++;
+            }
+        }
+    }
+
+    const GameCounters& gameCounters = appCore.getGameCounters();
+    return SimulationResult{gameCounters.get(CURRENT_SCORE), gameCounters.get(CURRENT_DISTANCE),
+                            gameCounters.get(CURRENT_COINS), enemyHits, bonuses, gameModel.getStepCount()};
+}
+
+/**
+ * @brief End a zone transition as soon as it becomes possible, as the view would do at its end
+ * @details Without it, no more elements would spawn after the first zone changing distance
+ *
+ * @param model the running game
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::emulateZoneTransition(GameModel& model) const
+{
+    if (model.isTransitionPossible()) {
+        model.disableTransitionPossibility();
+        model.setCurrentZone(model.getCurrentZone() == HILL ? PLAIN : HILL);
+    }
+}
+
+/**
+ * @brief Choose the player input of the next step following the input policy
+ * @details The bot jumps as soon as an enemy gets closer than a distance
+ * proportional to the game speed
+ *
+ * @param model the running game
+ * @param inputGenerator the generator of random inputs
+ * @return the player input as PlayerInput flags
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+unsigned int SimulationRunner::chooseInput(const GameModel& model, RandomGenerator& inputGenerator) const
+{
+    switch (m_input) {
+        case RANDOM_INPUT:
+            return inputGenerator.getUniformRandomNumber(1, 100) <= RANDOM_JUMP_PERCENTAGE ? INPUT_JUMP : INPUT_NONE;
+        case BOT_INPUT: {
+            const float enemyDistance = model.getNextEnemyDistance();
+            const bool isEnemyClose = enemyDistance >= 0
+                    && enemyDistance <= BOT_JUMP_DISTANCE_FACTOR * model.getGameSpeed();
+            return isEnemyClose ? INPUT_JUMP : INPUT_NONE;
+        }
+        case IDLE_INPUT:
+        default:
+            return INPUT_NONE;
+    }
+}
+
+/**
+ * @brief Print the distribution of a game value
+ *
+ * @param output the stream to print to
+ * @param label the value's label
+ * @param values the value of each game
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void SimulationRunner::printDistribution(std::ostream& output, const string& label, vector<int> values) const
+{
+    std::sort(values.begin(), values.end());
+
+    double sum = 0;
+    for (int value : values) {
+        sum += value;
+    }
+
+    const std::size_t last = values.size() - 1;
+    output << label << ": min " << values.front()
+           << ", p10 " << values[last * 10 / 100]
+           << ", median " << values[last / 2]
+           << ", p90 " << values[last * 90 / 100]
+           << ", max " << values.back()
+           << ", mean " << sum / values.size() << endl;
+}
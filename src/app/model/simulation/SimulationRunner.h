@@ -0,0 +1,116 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef SIMULATION_RUNNER_H
+#define SIMULATION_RUNNER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "app/model/enums/SimulationInput.h"
+#include "app/model/models/GameModel.h"
+#include "app/persistence/PersistenceManager.h"
+
+/**
+ * @struct SimulationResult
+ * @details Values of a finished headless game
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct SimulationResult
+{
+    int score;
+    int distance;
+    int coins;
+    int enemyHits;
+    int bonuses;
+    unsigned long steps;
+};
+
+/**
+ * @class SimulationRunner
+ * @details Run complete games without view and without wall-clock gating,
+ * the player being driven by a scripted input policy.
+ * Simulation steps are chained as fast as possible, so that the throughput
+ * of the model and the distribution of game results can be measured.
+ *
+ * Games are independent, so they are spread over a pool of worker threads,
+ * each worker owning its AppCore instance and its persistence context.
+ * Workers pick the next game to run from a shared counter, and each game
+ * is seeded from the runner's seed and its index, so that results
+ * don't depend on the number of threads and any game can be replayed.
+ * Random inputs come from a separate generator, so that they don't
+ * consume the game's random numbers.
+ * Without view, zone transitions are ended as soon as they become possible,
+ * and the first game can be recorded to be replayed later.
+ * Game statistics are counted from the game's events.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class SimulationRunner
+{
+public:
+    //=== CTORs / DTORs
+    SimulationRunner(float width, float height, const SimulationInput& input,
+                     unsigned long maxSteps, unsigned int threadCount, std::uint64_t seed);
+    ~SimulationRunner();
+
+    //=== GETTERS
+    const std::vector<SimulationResult>& getResults() const;
+    unsigned long getTotalSteps() const;
+    double getElapsedSeconds() const;
+    unsigned int getThreadCount() const;
+    std::uint64_t getSeed() const;
+
+    //=== SETTERS
+    void setRecordPath(const std::string& path);
+
+    //=== METHODS
+    void run(unsigned int gameCount, const Difficulty& difficulty);
+    void clearResults();
+    void printReport(std::ostream& output) const;
+
+private:
+    //=== ATTRIBUTES
+    float m_width, m_height;
+    SimulationInput m_input;
+    unsigned long m_maxSteps;
+    unsigned int m_threadCount;
+    std::uint64_t m_seed;
+    std::string m_recordPath;
+    std::vector<SimulationResult> m_results;
+    std::chrono::nanoseconds m_elapsedTime;
+
+    //Constants
+    const int RANDOM_JUMP_PERCENTAGE = 5;
+    const float BOT_JUMP_DISTANCE_FACTOR = 16;
+    const std::uint64_t INPUT_STREAM = 0x5eed1e55;
+
+    //=== PRIVATE METHODS
+    void runWorker(std::size_t firstResult, unsigned int gameCount,
+                   const Difficulty& difficulty, std::atomic<unsigned int>* nextGame);
+    SimulationResult runGame(AppCore& appCore, std::uint64_t seed, const std::string& recordPath) const;
+    void emulateZoneTransition(GameModel& model) const;
+    unsigned int chooseInput(const GameModel& model, RandomGenerator& inputGenerator) const;
+    void printDistribution(std::ostream& output, const std::string& label, std::vector<int> values) const;
+};
+
+#endif
@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include "GameSnapshot.h"
+
+using std::string;
+
+constexpr std::uint16_t GameSnapshot::VERSION;
+
+namespace
+{
+const char MAGIC[] = {'B', 'K', 'R', 'S'};
+
+std::uint32_t computeCrc32(const unsigned char* data, std::size_t size)
+{
+    static const std::array<std::uint32_t, 256> table = []() {
+        std::array<std::uint32_t, 256> crcTable{};
+        for (std::uint32_t i = 0; i < crcTable.size(); i++) {
+            std::uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc & 1u) != 0 ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+            }
+            crcTable[i] = crc;
+        }
+        return crcTable;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+}
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor of an empty snapshot
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+GameSnapshot::GameSnapshot() : m_readOffset{0}
+{}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+GameSnapshot::~GameSnapshot() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::size_t GameSnapshot::getSize() const { return m_buffer.size(); }
+std::size_t GameSnapshot::getCapacity() const { return m_buffer.capacity(); }
+bool GameSnapshot::isEmpty() const { return m_buffer.empty(); }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Allocate the buffer once, so that saves up to this size don't allocate
+ *
+ * @param size the size to reserve in bytes
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameSnapshot::reserve(std::size_t size)
+{
+    m_buffer.reserve(size);
+}
+
+/**
+ * @brief Empty the snapshot before a new save, keeping its memory
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameSnapshot::clear()
+{
+    m_buffer.clear();
+    m_readOffset = 0;
+}
+
+/**
+ * @brief Go back to the first value, before a restore
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void GameSnapshot::rewind()
+{
+    m_readOffset = 0;
+}
+
+/**
+ * @brief Read the next boolean of the snapshot
+ * @details Booleans are checked, a byte other than 0 or 1 not being a valid boolean
+ *
+ * @param value the value to fill
+ * @return true if the snapshot held a boolean
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool GameSnapshot::read(bool& value)
+{
+    static_assert(sizeof(bool) == sizeof(unsigned char), "Booleans are written as single bytes");
+    unsigned char byte;
+
+    if (!read(byte) || byte > 1) {
+        return false;
+    }
+
+    value = byte != 0;
+    return true;
+}
+
+/**
+ * @brief Save the snapshot to a file, replacing any existing file
+ * @details Values are followed by their CRC-32, so that corrupted files can be detected
+ *
+ * @param path the file path
+ * @return true if the snapshot was saved
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool GameSnapshot::saveToFile(const string& path) const
+{
+    std::ofstream file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    const std::uint64_t size = m_buffer.size();
+    const std::uint32_t crc = computeCrc32(m_buffer.data(), m_buffer.size());
+
+    file.write(MAGIC, sizeof(MAGIC));
+    file.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(size));
+    file.write(reinterpret_cast<const char*>(&crc), sizeof(crc));
+
+    return file.good();
+}
+
+/**
+ * @brief Load a snapshot saved to a file, checking its magic, version, size and checksum
+ *
+ * @param path the file path
+ * @return true if a complete snapshot was loaded, the snapshot being empty otherwise
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool GameSnapshot::loadFromFile(const string& path)
+{
+    std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    std::uint16_t version;
+    std::uint64_t size;
+    std::uint32_t crc;
+
+    clear();
+
+    if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), MAGIC)
+            || !file.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != VERSION
+            || !file.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+        return false;
+    }
+
+    const std::streampos dataPosition = file.tellg();
+    file.seekg(0, std::ios::end);
+    const auto dataSize = static_cast<std::uint64_t>(file.tellg() - dataPosition);
+    if (dataSize < sizeof(crc) || dataSize - sizeof(crc) != size) {
+        return false;
+    }
+    file.seekg(dataPosition);
+
+    m_buffer.resize(static_cast<std::size_t>(size));
+    if (!file.read(reinterpret_cast<char*>(m_buffer.data()), static_cast<std::streamsize>(size))
+            || !file.read(reinterpret_cast<char*>(&crc), sizeof(crc))
+            || crc != computeCrc32(m_buffer.data(), m_buffer.size())) {
+        clear();
+        return false;
+    }
+    return true;
+}
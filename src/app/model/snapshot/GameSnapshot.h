@@ -0,0 +1,187 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class GameSnapshot
+ * @details Flat byte buffer holding the whole state of a running game,
+ * written and read back in the same order by the game's components.
+ * Values are plain data copied as they are in memory, so that saving and restoring
+ * are linear copies. The buffer keeps its memory between saves:
+ * once reserved or filled a first time, next saves don't allocate.
+ *
+ * A snapshot can be saved to a file to resume a game later,
+ * on the same platform with the same build. Files hold a checksum of the values,
+ * and readers check the values they read, so that a corrupted file is rejected.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class GameSnapshot
+{
+public:
+    //=== CTORs / DTORs
+    GameSnapshot();
+    ~GameSnapshot();
+
+    //=== GETTERS
+    std::size_t getSize() const;
+    std::size_t getCapacity() const;
+    bool isEmpty() const;
+
+    //=== METHODS
+    void reserve(std::size_t size);
+    void clear();
+    void rewind();
+    bool saveToFile(const std::string& path) const;
+    bool loadFromFile(const std::string& path);
+    bool read(bool& value);
+
+    /**
+     * @brief Append a plain data value to the snapshot
+     *
+     * @param value the value to write
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    template<typename Type>
+    void write(const Type& value)
+    {
+        static_assert(std::is_pod<Type>::value, "Only plain data can be written in a snapshot");
+
+        const std::size_t offset = m_buffer.size();
+        m_buffer.resize(offset + sizeof(Type));
+        std::memcpy(&m_buffer[offset], &value, sizeof(Type));
+    }
+
+    /**
+     * @brief Append an array of plain data values to the snapshot, preceded by its size
+     *
+     * @param values the values to write
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    template<typename Type>
+    void writeArray(const std::vector<Type>& values)
+    {
+        static_assert(std::is_pod<Type>::value, "Only plain data can be written in a snapshot");
+
+        write(static_cast<std::uint32_t>(values.size()));
+
+        const std::size_t offset = m_buffer.size();
+        m_buffer.resize(offset + values.size() * sizeof(Type));
+        if (!values.empty()) {
+            std::memcpy(&m_buffer[offset], values.data(), values.size() * sizeof(Type));
+        }
+    }
+
+    /**
+     * @brief Read the next plain data value of the snapshot
+     *
+     * @param value the value to fill
+     * @return true if the snapshot held a value
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    template<typename Type>
+    bool read(Type& value)
+    {
+        static_assert(std::is_pod<Type>::value, "Only plain data can be read from a snapshot");
+
+        if (m_buffer.size() - m_readOffset < sizeof(Type)) {
+            return false;
+        }
+
+        std::memcpy(&value, &m_buffer[m_readOffset], sizeof(Type));
+        m_readOffset += sizeof(Type);
+        return true;
+    }
+
+    /**
+     * @brief Read the next enum value of the snapshot, checking its range
+     *
+     * @param value the value to fill
+     * @param first the first valid value
+     * @param last the last valid value
+     * @return true if the snapshot held a value within the range
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    template<typename Type>
+    bool readEnum(Type& value, Type first, Type last)
+    {
+        typedef typename std::underlying_type<Type>::type Underlying;
+        Underlying rawValue;
+
+        if (!read(rawValue) || rawValue < static_cast<Underlying>(first) || rawValue > static_cast<Underlying>(last)) {
+            return false;
+        }
+
+        value = static_cast<Type>(rawValue);
+        return true;
+    }
+
+    /**
+     * @brief Read the next array of plain data values of the snapshot
+     * @details The array's memory is reused, it doesn't allocate
+     * while the array capacity is big enough
+     *
+     * @param values the array to fill
+     * @param maxSize the maximum size of the array
+     * @return true if the snapshot held an array which isn't bigger than the maximum size
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    template<typename Type>
+    bool readArray(std::vector<Type>& values, std::size_t maxSize)
+    {
+        static_assert(std::is_pod<Type>::value, "Only plain data can be read from a snapshot");
+
+        std::uint32_t size;
+        if (!read(size) || size > maxSize || (m_buffer.size() - m_readOffset) / sizeof(Type) < size) {
+            return false;
+        }
+
+        values.resize(size);
+        if (size != 0) {
+            std::memcpy(values.data(), &m_buffer[m_readOffset], size * sizeof(Type));
+        }
+        m_readOffset += size * sizeof(Type);
+        return true;
+    }
+
+private:
+    //=== ATTRIBUTES
+    std::vector<unsigned char> m_buffer;
+    std::size_t m_readOffset;
+
+    //Constants
+    static constexpr std::uint16_t VERSION = 4;
+};
+
+#endif
@@ -0,0 +1,246 @@
+#include "CollisionUtils.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define COLLISION_SSE2_KERNEL 1
+#include <emmintrin.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define COLLISION_AVX_KERNEL 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+
+typedef void (* overlap_kernel_t)(float left, float top, float right, float bottom,
+                                  const float* lefts, const float* tops, const float* rights, const float* bottoms,
+                                  std::size_t count, std::uint32_t* hitMask);
+
+/**
+ * Tests a box against packed boxes one by one
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void findOverlapsScalarKernel(float left, float top, float right, float bottom,
+                              const float* lefts, const float* tops, const float* rights, const float* bottoms,
+                              std::size_t count, std::uint32_t* hitMask)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        if (CollisionUtils::overlap(left, top, right, bottom, lefts[i], tops[i], rights[i], bottoms[i])) {
+            hitMask[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+#if defined(COLLISION_SSE2_KERNEL)
+
+/**
+ * Tests a box against packed boxes 4 at a time
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void findOverlapsSSE2Kernel(float left, float top, float right, float bottom,
+                            const float* lefts, const float* tops, const float* rights, const float* bottoms,
+                            std::size_t count, std::uint32_t* hitMask)
+{
+    const __m128 boxLeft = _mm_set1_ps(left);
+    const __m128 boxTop = _mm_set1_ps(top);
+    const __m128 boxRight = _mm_set1_ps(right);
+    const __m128 boxBottom = _mm_set1_ps(bottom);
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 hits = _mm_cmple_ps(_mm_loadu_ps(lefts + i), boxRight);
+        hits = _mm_and_ps(hits, _mm_cmpge_ps(_mm_loadu_ps(rights + i), boxLeft));
+        hits = _mm_and_ps(hits, _mm_cmple_ps(_mm_loadu_ps(tops + i), boxBottom));
+        hits = _mm_and_ps(hits, _mm_cmpge_ps(_mm_loadu_ps(bottoms + i), boxTop));
+
+        hitMask[i / 32] |= static_cast<std::uint32_t>(_mm_movemask_ps(hits)) << (i % 32);
+    }
+
+    for (; i < count; i++) {
+        if (CollisionUtils::overlap(left, top, right, bottom, lefts[i], tops[i], rights[i], bottoms[i])) {
+            hitMask[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+#endif
+
+#if defined(COLLISION_AVX_KERNEL)
+
+/**
+ * Tests a box against packed boxes 8 at a time
+ * @warning It must only be called if the CPU supports AVX
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+__attribute__((target("avx")))
+void findOverlapsAVXKernel(float left, float top, float right, float bottom,
+                           const float* lefts, const float* tops, const float* rights, const float* bottoms,
+                           std::size_t count, std::uint32_t* hitMask)
+{
+    const __m256 boxLeft = _mm256_set1_ps(left);
+    const __m256 boxTop = _mm256_set1_ps(top);
+    const __m256 boxRight = _mm256_set1_ps(right);
+    const __m256 boxBottom = _mm256_set1_ps(bottom);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256 hits = _mm256_cmp_ps(_mm256_loadu_ps(lefts + i), boxRight, _CMP_LE_OQ);
+        hits = _mm256_and_ps(hits, _mm256_cmp_ps(_mm256_loadu_ps(rights + i), boxLeft, _CMP_GE_OQ));
+        hits = _mm256_and_ps(hits, _mm256_cmp_ps(_mm256_loadu_ps(tops + i), boxBottom, _CMP_LE_OQ));
+        hits = _mm256_and_ps(hits, _mm256_cmp_ps(_mm256_loadu_ps(bottoms + i), boxTop, _CMP_GE_OQ));
+
+        hitMask[i / 32] |= static_cast<std::uint32_t>(_mm256_movemask_ps(hits)) << (i % 32);
+    }
+
+    for (; i < count; i++) {
+        if (CollisionUtils::overlap(left, top, right, bottom, lefts[i], tops[i], rights[i], bottoms[i])) {
+            hitMask[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+#endif
+
+/**
+ * Selects the widest kernel supported by the running CPU
+ *
+ * @param name the selected kernel name
+ * @return the selected kernel
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+overlap_kernel_t selectKernel(const char*& name)
+{
+#if defined(COLLISION_AVX_KERNEL)
+    if (__builtin_cpu_supports("avx")) {
+        name = "avx";
+        return findOverlapsAVXKernel;
+    }
+#endif
+#if defined(COLLISION_SSE2_KERNEL)
+    name = "sse2";
+    return findOverlapsSSE2Kernel;
+#else
+    name = "scalar";
+    return findOverlapsScalarKernel;
+#endif
+}
+
+/**
+ * Gets the kernel selected for the running CPU, once for all
+ *
+ * @param name the selected kernel name
+ * @return the selected kernel
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+overlap_kernel_t getKernel(const char*& name)
+{
+    static const char* selectedName = nullptr;
+    static const overlap_kernel_t selectedKernel = selectKernel(selectedName);
+
+    name = selectedName;
+    return selectedKernel;
+}
+
+/**
+ * Runs a kernel on a batch
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void runKernel(overlap_kernel_t kernel, float left, float top, float right, float bottom,
+               const BoundingBoxBatch& batch, std::vector<std::uint32_t>& hitMask)
+{
+    hitMask.assign((batch.getSize() + 31) / 32, 0);
+
+    if (batch.getSize() > 0) {
+        kernel(left, top, right, bottom, batch.getLefts(), batch.getTops(), batch.getRights(), batch.getBottoms(),
+               batch.getSize(), hitMask.data());
+    }
+}
+
+}
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Test a box against all boxes of a batch
+ *
+ * @param left the box left edge
+ * @param top the box top edge
+ * @param right the box right edge
+ * @param bottom the box bottom edge
+ * @param batch the boxes to test against
+ * @param hitMask the result, i-th bit being set if i-th box of the batch overlaps
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void CollisionUtils::findOverlaps(float left, float top, float right, float bottom,
+                                  const BoundingBoxBatch& batch, std::vector<std::uint32_t>& hitMask)
+{
+    const char* name;
+    runKernel(getKernel(name), left, top, right, bottom, batch, hitMask);
+}
+
+/**
+ * @brief Test a box against all boxes of a batch without SIMD instructions
+ * @details Reference implementation of findOverlaps()
+ *
+ * @param left the box left edge
+ * @param top the box top edge
+ * @param right the box right edge
+ * @param bottom the box bottom edge
+ * @param batch the boxes to test against
+ * @param hitMask the result, i-th bit being set if i-th box of the batch overlaps
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void CollisionUtils::findOverlapsScalar(float left, float top, float right, float bottom,
+                                        const BoundingBoxBatch& batch, std::vector<std::uint32_t>& hitMask)
+{
+    runKernel(findOverlapsScalarKernel, left, top, right, bottom, batch, hitMask);
+}
+
+/**
+ * @brief Check a box result in a hit mask
+ *
+ * @param hitMask the hit mask filled by findOverlaps()
+ * @param index the box index in the batch
+ * @return a boolean indicating if the box overlaps
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool CollisionUtils::isHit(const std::vector<std::uint32_t>& hitMask, std::size_t index)
+{
+    return (hitMask[index / 32] >> (index % 32)) & 1u;
+}
+
+/**
+ * @brief Get the name of the kernel used by findOverlaps()
+ *
+ * @return "avx", "sse2" or "scalar"
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+const char* CollisionUtils::getKernelName()
+{
+    const char* name;
+    getKernel(name);
+    return name;
+}
@@ -0,0 +1,114 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef COLLISION_UTILS_H
+#define COLLISION_UTILS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BoundingBoxBatch
+ * @details Packed axis-aligned bounding boxes, one array per edge,
+ * ready to be tested all at once by CollisionUtils
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class BoundingBoxBatch
+{
+public:
+    //=== GETTERS
+    std::size_t getSize() const { return m_lefts.size(); }
+    const float* getLefts() const { return m_lefts.data(); }
+    const float* getTops() const { return m_tops.data(); }
+    const float* getRights() const { return m_rights.data(); }
+    const float* getBottoms() const { return m_bottoms.data(); }
+
+    //=== SETTERS
+    void resize(std::size_t size)
+    {
+        m_lefts.resize(size);
+        m_tops.resize(size);
+        m_rights.resize(size);
+        m_bottoms.resize(size);
+    }
+
+    void setBox(std::size_t index, float left, float top, float right, float bottom)
+    {
+        m_lefts[index] = left;
+        m_tops[index] = top;
+        m_rights[index] = right;
+        m_bottoms[index] = bottom;
+    }
+
+    //=== METHODS
+    void add(float left, float top, float right, float bottom)
+    {
+        m_lefts.push_back(left);
+        m_tops.push_back(top);
+        m_rights.push_back(right);
+        m_bottoms.push_back(bottom);
+    }
+
+    void clear() { resize(0); }
+
+private:
+    //=== ATTRIBUTES
+    std::vector<float> m_lefts;
+    std::vector<float> m_tops;
+    std::vector<float> m_rights;
+    std::vector<float> m_bottoms;
+};
+
+/**
+ * @class CollisionUtils
+ * @details Provide axis-aligned bounding boxes overlap tests.
+ * All tests follow the same convention: y-axis goes downward,
+ * and boxes edges are included, so that touching boxes overlap.
+ *
+ * Batch tests use the widest SIMD instruction set supported by the CPU,
+ * selected at runtime, and fall back to scalar code otherwise.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class CollisionUtils
+{
+public:
+    /**
+     * Checks if two boxes overlap
+     *
+     * @return a boolean indicating if boxes overlap
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    static bool overlap(float leftA, float topA, float rightA, float bottomA,
+                        float leftB, float topB, float rightB, float bottomB)
+    {
+        return leftA <= rightB && rightA >= leftB && topA <= bottomB && bottomA >= topB;
+    }
+
+    static void findOverlaps(float left, float top, float right, float bottom,
+                             const BoundingBoxBatch& batch, std::vector<std::uint32_t>& hitMask);
+    static void findOverlapsScalar(float left, float top, float right, float bottom,
+                                   const BoundingBoxBatch& batch, std::vector<std::uint32_t>& hitMask);
+    static bool isHit(const std::vector<std::uint32_t>& hitMask, std::size_t index);
+    static const char* getKernelName();
+};
+
+#endif
@@ -0,0 +1,147 @@
+#include <chrono>
+#include <random>
+#include "RandomGenerator.h"
+
+constexpr std::uint64_t RandomGenerator::DEFAULT_STREAM;
+constexpr std::uint64_t RandomGenerator::MULTIPLIER;
+
+//------------------------------------------------
+//          CONSTRUCTOR / DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * @brief Constructor
+ *
+ * @param seed the initial state seed
+ * @param stream the sequence selector, generators with different streams never overlap
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+RandomGenerator::RandomGenerator(std::uint64_t seed, std::uint64_t stream) :
+        m_seed{0}, m_state{0}, m_increment{0}
+{
+    this->seed(seed, stream);
+}
+
+/**
+ * @brief Destructor
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+RandomGenerator::~RandomGenerator() = default;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::uint64_t RandomGenerator::getSeed() const { return m_seed; }
+std::uint64_t RandomGenerator::getState() const { return m_state; }
+std::uint64_t RandomGenerator::getIncrement() const { return m_increment; }
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Restart the generator from a given seed
+ *
+ * @param seed the initial state seed
+ * @param stream the sequence selector
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void RandomGenerator::seed(std::uint64_t seed, std::uint64_t stream)
+{
+    m_seed = seed;
+    m_state = 0;
+    m_increment = (stream << 1u) | 1u;
+    next();
+    m_state += seed;
+    next();
+}
+
+/**
+ * @brief Resume a sequence from a saved state
+ *
+ * @param seed the initial state seed of the sequence
+ * @param state the saved state
+ * @param increment the saved increment, selecting the sequence
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void RandomGenerator::restore(std::uint64_t seed, std::uint64_t state, std::uint64_t increment)
+{
+    m_seed = seed;
+    m_state = state;
+    m_increment = increment | 1u;
+}
+
+/**
+ * @brief Draw the next 32 bits number
+ *
+ * @return a number uniformly distributed over the 32 bits range
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::uint32_t RandomGenerator::next()
+{
+    const std::uint64_t oldState = m_state;
+    m_state = oldState * MULTIPLIER + m_increment;
+
+    const auto xorShifted = static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+    const auto rotation = static_cast<std::uint32_t>(oldState >> 59u);
+    return (xorShifted >> rotation) | (xorShifted << ((-rotation) & 31u));
+}
+
+/**
+ * @brief Provide uniformly an integer number between 2 limits
+ * @details Uses a multiplication followed by a rejection of the rare biased draws,
+ * which avoids divisions most of the time
+ *
+ * @param a the min limit
+ * @param b the max limit, not less than a
+ * @return an integer in [a, b] range
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+int RandomGenerator::getUniformRandomNumber(int a, int b)
+{
+    const std::uint32_t range = static_cast<std::uint32_t>(b) - static_cast<std::uint32_t>(a) + 1u;
+    if (range == 0) {
+        return static_cast<int>(next());
+    }
+
+    std::uint64_t product = static_cast<std::uint64_t>(next()) * range;
+    auto low = static_cast<std::uint32_t>(product);
+
+    if (low < range) {
+        const std::uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(next()) * range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+
+    return static_cast<int>(static_cast<std::uint32_t>(a) + static_cast<std::uint32_t>(product >> 32u));
+}
+
+/**
+ * @brief Generate a seed for a new unseeded game
+ *
+ * @return a seed mixing a hardware random number and the current time
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::uint64_t RandomGenerator::generateSeed()
+{
+    std::random_device device;
+    const auto time = static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return (static_cast<std::uint64_t>(device()) << 32u) ^ static_cast<std::uint64_t>(device()) ^ time;
+}
@@ -0,0 +1,63 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RANDOM_GENERATOR_H
+#define RANDOM_GENERATOR_H
+
+#include <cstdint>
+
+/**
+ * @class RandomGenerator
+ * @details Small and fast seedable pseudo-random generator (PCG32, XSH-RR variant),
+ * owned by each game so that a seed reproduces all its random choices.
+ * Bounded numbers are drawn without standard distributions, which are
+ * implementation-defined, so that sequences are identical on all platforms.
+ * The whole generator state can be saved and restored to resume a sequence.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class RandomGenerator
+{
+public:
+    //=== CTORs / DTORs
+    explicit RandomGenerator(std::uint64_t seed, std::uint64_t stream = DEFAULT_STREAM);
+    ~RandomGenerator();
+
+    //=== GETTERS
+    std::uint64_t getSeed() const;
+    std::uint64_t getState() const;
+    std::uint64_t getIncrement() const;
+
+    //=== METHODS
+    void seed(std::uint64_t seed, std::uint64_t stream = DEFAULT_STREAM);
+    void restore(std::uint64_t seed, std::uint64_t state, std::uint64_t increment);
+    std::uint32_t next();
+    int getUniformRandomNumber(int a, int b);
+
+    static std::uint64_t generateSeed();
+
+private:
+    //=== ATTRIBUTES
+    std::uint64_t m_seed;
+    std::uint64_t m_state;
+    std::uint64_t m_increment;
+
+    //Constants
+    static constexpr std::uint64_t DEFAULT_STREAM = 0xda3e39cb94b95bdbULL;
+    static constexpr std::uint64_t MULTIPLIER = 6364136223846793005ULL;
+};
+
+#endif
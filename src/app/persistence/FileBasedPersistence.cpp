@@ -3,6 +3,7 @@
 using std::string;
 using std::to_string;
 using Bokoblin::XMLUtils::XmlDocument;
+using Bokoblin::XMLUtils::MappedXMLDocument;
 using Bokoblin::XMLUtils::XmlNode;
 using Bokoblin::XMLUtils::XmlAttribute;
 using Bokoblin::SimpleLogger::Logger;
@@ -13,8 +14,8 @@ namespace ModelResources = Bokoblin::BokoRunner::Resources::Model;
 //          STATIC MEMBERS
 //------------------------------------------------
 
-AppCore* FileBasedPersistence::m_appCore = nullptr;
-XmlDocument FileBasedPersistence::m_doc;
+thread_local AppCore* FileBasedPersistence::m_appCore = nullptr;
+thread_local MappedXMLDocument FileBasedPersistence::m_doc;
 
 
 //------------------------------------------------
@@ -75,7 +76,7 @@ bool FileBasedPersistence::loadConfigFile()
  * @brief Remove the config file
  *
  * @author Arthur
- * @date 25/08/18
+ * @date 25/08/18 - 17/10/2026
  */
 bool FileBasedPersistence::removeConfigFile()
 {
@@ -86,57 +87,17 @@ bool FileBasedPersistence::removeConfigFile()
 
 /**
  * @brief Checks a stream integrity
- * @details Checks if a stream is corrupted
- * by verifying number of lines, number of each item
+ * @details Parses the stream then checks the document integrity
  *
  * @return a boolean indicating if file is corrupted
  *
  * @author Arthur
- * @date 02/05/16 - 22/07/18
+ * @date 02/05/16 - 17/10/2026
  */
 bool FileBasedPersistence::checkStreamIntegrity(std::istream& stream)
 {
-    string content;
-    string line;
-
-    //=== Count lines / elements test
-    bool isPresentConfig = false; //should be true
-    bool isPresentStats = false; //should be true
-    bool isPresentShop = false; //should be true
-    bool isPresentScoreEasy = false; //should be true
-    bool isPresentScoreHard = false; //should be true
-    int nbLines = 0; //should be 52 or 53
-    int nbConfigChildren = 0; //should be 6
-    int nbStatsChildren = 0; //should be 7
-    int nbShopChildren = 0; //should be 6
-    int nbScoreChildren = 0; //should be 20
-
-    do {
-        getline(stream, line, '\n');
-        content.append(line);
-        nbLines++;
-
-        isPresentConfig = line.find("<config>") != string::npos ? true : isPresentConfig;
-        isPresentStats = line.find("<stats>") != string::npos ? true : isPresentStats;
-        isPresentShop = line.find("<shop>") != string::npos ? true : isPresentShop;
-        isPresentScoreEasy = line.find("<scoresEasy>") != string::npos ? true : isPresentScoreEasy;
-        isPresentScoreHard = line.find("<scoresHard>") != string::npos ? true : isPresentScoreHard;
-
-        nbConfigChildren = line.find("<configItem") != string::npos ? nbConfigChildren + 1 : nbConfigChildren;
-        nbStatsChildren = line.find("<statItem") != string::npos ? nbStatsChildren + 1 : nbStatsChildren;
-        nbShopChildren = line.find("<shopItem") != string::npos ? nbShopChildren + 1 : nbShopChildren;
-        nbScoreChildren = line.find("<scoreItem") != string::npos ? nbScoreChildren + 1 : nbScoreChildren;
-    } while (!stream.eof());
-
-    //To overcome the limitation of "stream" being emptied by XMLHelper::checkXMLStreamIntegrity()
-    std::stringstream ss;
-    ss << content.c_str();
-    if (!XMLHelper::checkXMLStreamIntegrity(ss)) {
-        return false;
-    }
-
-    return isPresentConfig && isPresentStats && isPresentShop && isPresentScoreEasy && isPresentScoreHard
-            && nbConfigChildren == 6 && nbStatsChildren == 7 && nbShopChildren == 6 && nbScoreChildren == 20;
+    XmlDocument doc;
+    return doc.load(stream).status == pugi::status_ok && checkDocumentIntegrity(doc);
 }
 
 
@@ -146,37 +107,57 @@ bool FileBasedPersistence::checkStreamIntegrity(std::istream& stream)
  * @return a boolean indicating if file is corrupted
  *
  * @author Arthur
- * @date 02/05/16 - 17/07/18
+ * @date 02/05/16 - 17/10/2026
  */
 bool FileBasedPersistence::checkStreamIntegrityFromConfigFile()
 {
     nullSafeGuard();
 
-    std::fstream f;
-    f.open(m_appCore->getPersistenceContext().c_str(), std::ios::in);
-
-    if (!f.fail()) {
-        return checkStreamIntegrity(f);
-    } else {
-        return false;
-    }
+    MappedXMLDocument doc;
+    return XMLHelper::loadXMLFile(doc, m_appCore->getPersistenceContext()) && checkDocumentIntegrity(doc.getDocument());
 }
 
 
 /**
  * @brief Checks XML document integrity
+ * @details Checks the loaded document itself, without saving nor parsing it again
  *
  * @return a boolean indicating if file is corrupted
  *
  * @author Arthur
- * @date 17/07/2018
+ * @date 17/07/2018 - 17/10/2026
  */
 bool FileBasedPersistence::checkStreamIntegrityFromXMLDocument()
 {
-    std::stringstream stream;
-    m_doc.save(stream);
+    return checkDocumentIntegrity(m_doc.getDocument());
+}
+
 
-    return checkStreamIntegrity(stream);
+/**
+ * @brief Checks a document integrity
+ * @details Checks if a document is corrupted
+ * by verifying its sections and their number of items
+ *
+ * @param doc the document to check
+ * @return a boolean indicating if document is corrupted
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool FileBasedPersistence::checkDocumentIntegrity(const XmlDocument& doc)
+{
+    const XmlNode runner = doc.child("runner");
+    const XmlNode config = runner.child("config");
+    const XmlNode stats = runner.child("stats");
+    const XmlNode shop = runner.child("shop");
+    const XmlNode scoresEasy = runner.child("scoresEasy");
+    const XmlNode scoresHard = runner.child("scoresHard");
+
+    return config && stats && shop && scoresEasy && scoresHard
+            && countChildren(config, "configItem") == 6
+            && countChildren(stats, "statItem") == 7
+            && countChildren(shop, "shopItem") == 6
+            && countChildren(scoresEasy, "scoreItem") + countChildren(scoresHard, "scoreItem") == 20;
 }
 
 
@@ -184,13 +165,13 @@ bool FileBasedPersistence::checkStreamIntegrityFromXMLDocument()
  * @brief Updates configuration values from file
  *
  * @author Arthur
- * @date 24/10/16 - 26/01/18
+ * @date 24/10/16 - 17/10/2026
  */
 bool FileBasedPersistence::fetchConfigurationFromConfigFile()
 {
     nullSafeGuard();
 
-    XmlNode config = m_doc.child("runner").child("config");
+    XmlNode config = m_doc.getDocument().child("runner").child("config");
 
     for (XmlNode configItem: config.children("configItem")) {
         string nodeKey = string(configItem.attribute("name").value());
@@ -232,21 +213,27 @@ bool FileBasedPersistence::fetchConfigurationFromConfigFile()
 
 /**
  * @brief Updates statistics values from file
+ * @details Each statistic key is mapped once to its counter, unknown keys being ignored
  *
  * @author Arthur
- * @date 24/10/16 - 25/09/18
+ * @date 24/10/16 - 17/10/2026
  */
 bool FileBasedPersistence::fetchStatisticsFromConfigFile()
 {
     nullSafeGuard();
 
-    XmlNode stats = m_doc.child("runner").child("stats");
+    XmlNode stats = m_doc.getDocument().child("runner").child("stats");
+    StatCounter counter;
 
     for (XmlNode statItem: stats.children("statItem")) {
         string nodeKey = string(statItem.attribute("name").value());
         XmlAttribute nodeValue = statItem.attribute("value");
-        m_appCore->m_statsMap[nodeKey] =
-                XMLHelper::safeRetrieveXMLValue<unsigned int>(nodeValue, ModelResources::INTEGER_REGEX, 0);
+        if (m_appCore->m_statCounters.findCounter(nodeKey, counter)) {
+            m_appCore->m_statCounters.set(counter, static_cast<int>(
+                    XMLHelper::safeRetrieveXMLValue<unsigned int>(nodeValue, ModelResources::INTEGER_REGEX, 0)));
+        } else {
+            Logger::printWarning("Unknown statistic ignored: ", nodeKey);
+        }
     }
 
     return true;
@@ -258,14 +245,14 @@ bool FileBasedPersistence::fetchStatisticsFromConfigFile()
  * with values from config file
  *
  * @author Arthur
- * @date 23/10/16 - 25/09/18
+ * @date 23/10/16 - 17/10/2026
  */
 bool FileBasedPersistence::fetchLeaderboardFromConfigFile()
 {
     nullSafeGuard();
 
-    XmlNode scoresEasy = m_doc.child("runner").child("scoresEasy");
-    XmlNode scoresHard = m_doc.child("runner").child("scoresHard");
+    XmlNode scoresEasy = m_doc.getDocument().child("runner").child("scoresEasy");
+    XmlNode scoresHard = m_doc.getDocument().child("runner").child("scoresHard");
 
     m_appCore->m_scoresEasyArray.clear();
     m_appCore->m_scoresHardArray.clear();
@@ -286,19 +273,19 @@ bool FileBasedPersistence::fetchLeaderboardFromConfigFile()
  * with values from config file
  *
  * @author Arthur
- * @date 14/05/16 - 26/01/18
+ * @date 14/05/16 - 17/10/2026
  */
 bool FileBasedPersistence::fetchActivatedBonusFromConfigFile()
 {
     nullSafeGuard();
 
-    XmlNode shop = m_doc.child("runner").child("shop");
+    XmlNode shop = m_doc.getDocument().child("runner").child("shop");
 
     for (XmlNode shopItem: shop.children("shopItem")) {
         if (string(shopItem.attribute("bought").value()) == "true") {
             const string ITEM_REGEX = "shop_[a-z]+[_]{0,1}[a-z]+";
-            m_appCore->m_activatedItemsArray.insert(XMLHelper::safeRetrieveXMLValue<string>
-                                                            (shopItem.attribute("id"), ITEM_REGEX, ""));
+            m_appCore->addNewActivatedBonus(XMLHelper::safeRetrieveXMLValue<string>
+                                                    (shopItem.attribute("id"), ITEM_REGEX, ""));
         }
     }
     return true;
@@ -310,13 +297,13 @@ bool FileBasedPersistence::fetchActivatedBonusFromConfigFile()
  * with values from config file
  *
  * @author Arthur
- * @date 13/10/2018 - 02/05/2020
+ * @date 13/10/2018 - 17/10/2026
  */
 bool FileBasedPersistence::fetchShopItemsFromConfigFile()
 {
     nullSafeGuard();
 
-    XmlNode shop = m_doc.child("runner").child("shop");
+    XmlNode shop = m_doc.getDocument().child("runner").child("shop");
 
     if (!m_appCore->m_shopItemsArray.empty()) {
         m_appCore->cleanupShopItemsArray();
@@ -341,15 +328,15 @@ bool FileBasedPersistence::fetchShopItemsFromConfigFile()
  * @brief Pushes Configuration data to file
  *
  * @author Arthur
- * @date 02/05/16 - 25/09/18
+ * @date 02/05/16 - 17/10/2026
  */
 bool FileBasedPersistence::persistConfigurationToConfigFile()
 {
     nullSafeGuard();
 
-    XmlNode config = m_doc.child("runner").child("config");
-    XmlNode stats = m_doc.child("runner").child("stats");
-    XmlNode shop = m_doc.child("runner").child("shop");
+    XmlNode config = m_doc.getDocument().child("runner").child("config");
+    XmlNode stats = m_doc.getDocument().child("runner").child("stats");
+    XmlNode shop = m_doc.getDocument().child("runner").child("shop");
 
     //=== Save configuration
 
@@ -383,9 +370,12 @@ bool FileBasedPersistence::persistConfigurationToConfigFile()
 
     //=== Save stats
 
+    StatCounter counter;
     for (XmlNode statItem: stats.children("statItem")) {
         string nodeKey = string(statItem.attribute("name").value());
-        statItem.attribute("value").set_value(to_string(m_appCore->m_statsMap[nodeKey]).c_str());
+        if (m_appCore->m_statCounters.findCounter(nodeKey, counter)) {
+            statItem.attribute("value").set_value(to_string(m_appCore->m_statCounters.get(counter)).c_str());
+        }
     }
 
     //=== Save shop activated items
@@ -398,16 +388,36 @@ bool FileBasedPersistence::persistConfigurationToConfigFile()
 
     //=== Save leaderboard
 
-    saveScores(m_appCore->m_scoresEasyArray, m_doc.child("runner").child("scoresEasy"));
-    saveScores(m_appCore->m_scoresHardArray, m_doc.child("runner").child("scoresHard"));
+    saveScores(m_appCore->m_scoresEasyArray, m_doc.getDocument().child("runner").child("scoresEasy"));
+    saveScores(m_appCore->m_scoresHardArray, m_doc.getDocument().child("runner").child("scoresHard"));
 
-    return m_doc.save_file(m_appCore->getPersistenceContext().c_str());
+    return XMLHelper::saveXMLFile(m_doc.getDocument(), m_appCore->getPersistenceContext());
 }
 
 //------------------------------------------------
 //          PRIVATE METHODS
 //------------------------------------------------
 
+/**
+ * @brief Counts the children of a node with a given name
+ *
+ * @param node the parent node
+ * @param name the children name
+ * @return the number of children
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+int FileBasedPersistence::countChildren(const XmlNode& node, const char* name)
+{
+    int count = 0;
+    for (XmlNode child = node.child(name); child; child = child.next_sibling(name)) {
+        count++;
+    }
+    return count;
+}
+
+
 /**
  * @brief Checks if the app core is initialized.
  * Takes appropriate actions otherwise.
@@ -30,10 +30,12 @@ class AppCore;
 /**
  * The FileBasedPersistence class contains the logic for a file-based persistence. \n
  * It is designed to be used only by the PersistenceManager class. \n
- * This persistence uses an xml config file.
+ * This persistence uses an xml config file, mapped and parsed once then checked in memory. \n
+ * The bound AppCore and the loaded document are thread local,
+ * each thread having its own persistence context.
  *
  * @author Arthur
- * @date 25/08/18 - 13/10/18
+ * @date 25/08/18 - 17/10/2026
  */
 class FileBasedPersistence
 {
@@ -45,6 +47,7 @@ public:
     static bool checkStreamIntegrity(std::istream& stream);
     static bool checkStreamIntegrityFromConfigFile();
     static bool checkStreamIntegrityFromXMLDocument();
+    static bool checkDocumentIntegrity(const Bokoblin::XMLUtils::XmlDocument& doc);
     static bool fetchConfigurationFromConfigFile();
     static bool fetchStatisticsFromConfigFile();
     static bool fetchActivatedBonusFromConfigFile();
@@ -59,13 +62,14 @@ public:
 private:
     //=== METHODS
     static void nullSafeGuard();
+    static int countChildren(const Bokoblin::XMLUtils::XmlNode& node, const char* name);
     static void insertScore(std::set<int>& array, const pugi::xml_node& scoreItem);
     static void saveScores(const std::set<int>& array, const pugi::xml_node& scoreNode);
     static std::string generateDefaultStringConfig();
 
     //=== ATTRIBUTES
-    static AppCore* m_appCore;
-    static Bokoblin::XMLUtils::XmlDocument m_doc;
+    static thread_local AppCore* m_appCore;
+    static thread_local Bokoblin::XMLUtils::MappedXMLDocument m_doc;
 };
 
 #endif
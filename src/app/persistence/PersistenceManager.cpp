@@ -1,4 +1,5 @@
 #include "PersistenceManager.h"
+#include "libs/Logger/Tracer.h"
 
 using std::string;
 using Bokoblin::SimpleLogger::Logger;
@@ -7,7 +8,7 @@ using Bokoblin::SimpleLogger::Logger;
 //          STATIC MEMBERS
 //------------------------------------------------
 
-bool PersistenceManager::m_isInit = false;
+thread_local bool PersistenceManager::m_isInit = false;
 
 //------------------------------------------------
 //          GETTERS
@@ -22,9 +23,12 @@ bool PersistenceManager::isInit(){ return m_isInit; }
 /**
  * @brief Inits the app persistence manager context
  * and the persistence system
+ * @details The context is only bound to the calling thread
+ *
+ * @param appCore the app core to bind to the context
  *
  * @author Arthur
- * @date 04/02/18 - 13/01/19
+ * @date 04/02/18 - 17/10/2026
  */
 void PersistenceManager::initContext(AppCore& appCore)
 {
@@ -52,11 +56,12 @@ void PersistenceManager::closeContext()
  * by checking existence and creating otherwise
  *
  * @author Arthur
- * @date 04/02/18 - 25/08/2018
+ * @date 04/02/18 - 17/10/2026
  */
 void PersistenceManager::initPersistence()
 {
-    if (FileBasedPersistence::checkStreamIntegrityFromConfigFile() && FileBasedPersistence::loadConfigFile()) {
+    TRACE_SCOPE("persistence", "PersistenceManager::initPersistence");
+    if (FileBasedPersistence::loadConfigFile() && FileBasedPersistence::checkStreamIntegrityFromXMLDocument()) {
         Logger::printInfo("Persistence init success");
     } else {
         Logger::printWarning("Persistence context loading failure, creating it...");
@@ -91,10 +96,11 @@ void PersistenceManager::checkContext() noexcept(false)
  * from persistence system
  *
  * @author Arthur
- * @date 04/02/18 - 25/08/2018
+ * @date 04/02/18 - 17/10/2026
  */
 void PersistenceManager::fetchActivatedBonus()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::fetchActivatedBonus");
     try {
         PersistenceManager::checkContext();
 
@@ -104,7 +110,7 @@ void PersistenceManager::fetchActivatedBonus()
             Logger::printError("Activated bonus fetching failure");
         }
     } catch (const PersistenceException& e) {
-        Logger::printError(e.what() + string("Persistence context checking failure"));
+        Logger::printError(e.what(), "Persistence context checking failure");
     }
 }
 
@@ -114,10 +120,11 @@ void PersistenceManager::fetchActivatedBonus()
  * from persistence system
  *
  * @author Arthur
- * @date 04/02/18 - 25/08/2018
+ * @date 04/02/18 - 17/10/2026
  */
 void PersistenceManager::fetchConfiguration()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::fetchConfiguration");
     try {
         PersistenceManager::checkContext();
 
@@ -127,7 +134,7 @@ void PersistenceManager::fetchConfiguration()
             Logger::printError("Configuration fetching failure");
         }
     } catch (const PersistenceException& e) {
-        Logger::printError(e.what() + string("Persistence context checking failure"));
+        Logger::printError(e.what(), "Persistence context checking failure");
     }
 }
 
@@ -137,10 +144,11 @@ void PersistenceManager::fetchConfiguration()
  * from persistence system
  *
  * @author Arthur
- * @date 17/07/18 - 25/08/2018
+ * @date 17/07/18 - 17/10/2026
  */
 void PersistenceManager::fetchStatistics()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::fetchStatistics");
     try {
         PersistenceManager::checkContext();
 
@@ -150,7 +158,7 @@ void PersistenceManager::fetchStatistics()
             Logger::printError("Statistics fetching failure");
         }
     } catch (const PersistenceException& e) {
-        Logger::printError(e.what() + string("Persistence context checking failure"));
+        Logger::printError(e.what(), "Persistence context checking failure");
     }
 }
 
@@ -160,10 +168,11 @@ void PersistenceManager::fetchStatistics()
  * from persistence system
  *
  * @author Arthur
- * @date 04/02/18 - 25/08/2018
+ * @date 04/02/18 - 17/10/2026
  */
 void PersistenceManager::fetchLeaderboard()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::fetchLeaderboard");
     try {
         PersistenceManager::checkContext();
 
@@ -173,7 +182,7 @@ void PersistenceManager::fetchLeaderboard()
             Logger::printError("Leaderboard fetching failure");
         }
     } catch (const PersistenceException& e) {
-        Logger::printError(e.what() + string("Persistence context checking failure"));
+        Logger::printError(e.what(), "Persistence context checking failure");
     }
 }
 
@@ -183,10 +192,11 @@ void PersistenceManager::fetchLeaderboard()
  * from persistence system
  *
  * @author Arthur
- * @date 13/10/2018
+ * @date 13/10/2018 - 17/10/2026
  */
 void PersistenceManager::fetchShopItems()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::fetchShopItems");
     try {
         PersistenceManager::checkContext();
 
@@ -196,7 +206,7 @@ void PersistenceManager::fetchShopItems()
             Logger::printError("Shop items fetching failure");
         }
     } catch (const PersistenceException& e) {
-        Logger::printError(e.what() + string("Persistence context checking failure"));
+        Logger::printError(e.what(), "Persistence context checking failure");
     }
 }
 
@@ -206,10 +216,11 @@ void PersistenceManager::fetchShopItems()
  * of the persistence system
  *
  * @author Arthur
- * @date 04/02/18 - 25/08/18
+ * @date 04/02/18 - 17/10/2026
  */
 void PersistenceManager::updatePersistence()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::updatePersistence");
     try {
         PersistenceManager::checkContext();
 
@@ -219,7 +230,7 @@ void PersistenceManager::updatePersistence()
             Logger::printError("Configuration persistence failure");
         }
     } catch (const PersistenceException& e) {
-        Logger::printError(e.what() + string("Persistence context checking failure"));
+        Logger::printError(e.what(), "Persistence context checking failure");
     }
 }
 
@@ -228,10 +239,11 @@ void PersistenceManager::updatePersistence()
  * @brief Resets the persistence context.
  *
  * @author Arthur
- * @date 16/07/18 - 25/08/18
+ * @date 16/07/18 - 17/10/2026
  */
 void PersistenceManager::resetPersistence()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::resetPersistence");
     if (FileBasedPersistence::removeConfigFile()
             && FileBasedPersistence::createConfigFile()
             && FileBasedPersistence::loadConfigFile()) {
@@ -245,10 +257,11 @@ void PersistenceManager::resetPersistence()
  * @brief Deletes the persistence context
  *
  * @author Arthur
- * @date 04/02/17 - 25/08/18
+ * @date 04/02/17 - 17/10/2026
  */
 void PersistenceManager::deletePersistence()
 {
+    TRACE_SCOPE("persistence", "PersistenceManager::deletePersistence");
     if (FileBasedPersistence::removeConfigFile()) {
         Logger::printInfo("Persistence context successfully deleted");
     } else {
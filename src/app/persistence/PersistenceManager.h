@@ -27,10 +27,12 @@ class AppCore;
  * The PersistenceManager class manages the app persistence. \n
  * The persistence method is abstracted from app's point of view in order to easily change
  * persistence system by only changing this file. \n
- * The current persistence system used by this manager is a file-based config file.
+ * The current persistence system used by this manager is a file-based config file. \n
+ * The context is bound per thread: each thread inits its own context
+ * with its own AppCore instance.
  *
  * @author Arthur
- * @date 27/01/18 - 13/10/18
+ * @date 27/01/18 - 17/10/2026
  */
 class PersistenceManager
 {
@@ -54,7 +56,7 @@ public:
     static bool isInit();
 private:
     //=== ATTRIBUTES
-    static bool m_isInit;
+    static thread_local bool m_isInit;
 };
 
 #endif
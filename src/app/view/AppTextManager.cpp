@@ -1,4 +1,5 @@
 #include "AppTextManager.h"
+#include "app/localization/LocalizedStringIds.h"
 
 using std::string;
 using std::to_string;
@@ -43,6 +44,13 @@ AppTextManager::~AppTextManager()
 }
 
 
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+const sf::Font& AppTextManager::getCondensedFont() const { return m_condensedFont; }
+
+
 //------------------------------------------------
 //          METHODS
 //------------------------------------------------
@@ -176,7 +184,7 @@ void AppTextManager::handleAboutLinks(const sf::Event& event) const
  * following current language
  *
  * @author Arthur
- * @date 13/04/16 - 04/02/17
+ * @date 13/04/16 - 17/10/2026
  */
 void AppTextManager::updateWholeStandaloneTextContent()
 {
@@ -184,7 +192,7 @@ void AppTextManager::updateWholeStandaloneTextContent()
         t->setCharacterSize(DEFAULT_CHAR_SIZE);
         t->setFont(m_condensedFont);
         t->setFillColor(sf::Color::White);
-        t->setUtf8String(LocalizationManager::fetchLocalizedString(t->getDescription()));
+        t->setUtf32String(LocalizationManager::fetchLocalizedUtf32String(t->getDescription()));
     }
 }
 
@@ -211,7 +219,7 @@ void AppTextManager::syncSplashScreenText(bool continueVisibility)
  * @param currentPage the current settings page opened
  *
  * @author Arthur
- * @date 14/04/16 - 25/09/18
+ * @date 14/04/16 - 17/10/2026
  */
 void AppTextManager::syncMenuSettingsText(int currentPage)
 {
@@ -230,45 +238,45 @@ void AppTextManager::syncMenuSettingsText(int currentPage)
         m_statsTotalDistanceLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsTotalDistanceText->setPosition(0.35f * m_width, 0.32f * m_height);
         m_statsTotalDistanceText->setCharacterSize(CONTENT_CHAR_SIZE);
-        m_statsTotalDistanceText->setString(to_string(m_appCore->getStatsMap().at("total_distance_travelled")) + " m");
+        m_statsTotalDistanceText->setString(to_string(m_appCore->getStatCounters().get(TOTAL_DISTANCE_TRAVELLED)) + " m");
 
         m_statsTotalEnemiesLabel->setPosition(0.07f * m_width, 0.39f * m_height);
         m_statsTotalEnemiesLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsTotalEnemiesText->setPosition(0.35f * m_width, 0.39f * m_height);
         m_statsTotalEnemiesText->setCharacterSize(CONTENT_CHAR_SIZE);
-        m_statsTotalEnemiesText->setStringFromInt(m_appCore->getStatsMap().at("total_enemies_destroyed"));
+        m_statsTotalEnemiesText->setStringFromInt(m_appCore->getStatCounters().get(TOTAL_ENEMIES_DESTROYED));
 
         m_statsTotalCoinsLabel->setPosition(0.07f * m_width, 0.46f * m_height);
         m_statsTotalCoinsLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsTotalCoinsNbText->setPosition(0.35f * m_width, 0.46f * m_height);
         m_statsTotalCoinsNbText->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsTotalCoinsNbText->setFillColor(sf::Color::White);
-        m_statsTotalCoinsNbText->setStringFromInt(m_appCore->getStatsMap().at("total_coins_collected"));
+        m_statsTotalCoinsNbText->setStringFromInt(m_appCore->getStatCounters().get(TOTAL_COINS_COLLECTED));
 
         m_statsTotalGamesLabel->setPosition(0.07f * m_width, 0.53f * m_height);
         m_statsTotalGamesLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsTotalGamesText->setPosition(0.35f * m_width, 0.53f * m_height);
         m_statsTotalGamesText->setCharacterSize(CONTENT_CHAR_SIZE);
-        m_statsTotalGamesText->setStringFromInt(m_appCore->getStatsMap().at("total_games_played"));
+        m_statsTotalGamesText->setStringFromInt(m_appCore->getStatCounters().get(TOTAL_GAMES_PLAYED));
 
         m_statsPerGameDistanceLabel->setPosition(0.57f * m_width, 0.32f * m_height);
         m_statsPerGameDistanceLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsPerGameDistanceText->setPosition(m_width - 2 * 0.07f * m_width, 0.32f * m_height);
         m_statsPerGameDistanceText->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsPerGameDistanceText->setString(
-                to_string(m_appCore->getStatsMap().at("per_game_distance_travelled")) + " m");
+                to_string(m_appCore->getStatCounters().get(PER_GAME_DISTANCE_TRAVELLED)) + " m");
 
         m_statsPerGameEnemiesLabel->setPosition(0.57f * m_width, 0.39f * m_height);
         m_statsPerGameEnemiesLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsPerGameEnemiesText->setPosition(m_width - 2 * 0.07f * m_width, 0.39f * m_height);
         m_statsPerGameEnemiesText->setCharacterSize(CONTENT_CHAR_SIZE);
-        m_statsPerGameEnemiesText->setStringFromInt(m_appCore->getStatsMap().at("per_game_enemies_destroyed"));
+        m_statsPerGameEnemiesText->setStringFromInt(m_appCore->getStatCounters().get(PER_GAME_ENEMIES_DESTROYED));
 
         m_statsPerGameCoinsLabel->setPosition(0.57f * m_width, 0.46f * m_height);
         m_statsPerGameCoinsLabel->setCharacterSize(CONTENT_CHAR_SIZE);
         m_statsPerGameCoinsText->setPosition(m_width - 2 * 0.07f * m_width, 0.46f * m_height);
         m_statsPerGameCoinsText->setCharacterSize(CONTENT_CHAR_SIZE);
-        m_statsPerGameCoinsText->setStringFromInt(m_appCore->getStatsMap().at("per_game_coins_collected"));
+        m_statsPerGameCoinsText->setStringFromInt(m_appCore->getStatCounters().get(PER_GAME_COINS_COLLECTED));
     } else { //ABOUT
         m_aboutTitleLabel->setPositionSelfCentered(0.5f * m_width, 0.08f * m_height);
         m_aboutDescriptionLabel->setPosition(0.08f * m_width, 0.25f * m_height);
@@ -387,7 +395,7 @@ void AppTextManager::syncMenuShopText()
  * @param bonusTimeout the current bonus timeout
  *
  * @author Arthur
- * @date 02/04/16 - 13/01/19
+ * @date 02/04/16 - 17/10/2026
  */
 void AppTextManager::syncGameRunningText(int bonusTimeout)
 {
@@ -396,7 +404,7 @@ void AppTextManager::syncGameRunningText(int bonusTimeout)
     m_currentDistanceLabel->setPosition(0.55f * m_width, 0.91f * m_height);
     m_currentDistanceText->setPosition(0.78f * m_width, 0.91f * m_height);
     m_currentDistanceText->setFillColor(sf::Color::White);
-    m_currentDistanceText->setString(to_string(m_appCore->getGameMap().at("distance")) + " m");
+    m_currentDistanceText->setString(to_string(m_appCore->getGameValue(CURRENT_DISTANCE)) + " m");
 
     m_bonusTimeoutText->setPosition(0.95f * m_width, 0.91f * m_height);
     m_bonusTimeoutText->setVisible(bonusTimeout > 0);
@@ -408,7 +416,7 @@ void AppTextManager::syncGameRunningText(int bonusTimeout)
  * Syncs paused game standalone text
  *
  * @author Arthur
- * @date 02/04/2016 - 03/05/2020
+ * @date 02/04/2016 - 17/10/2026
  */
 void AppTextManager::syncGamePausedText()
 {
@@ -417,13 +425,13 @@ void AppTextManager::syncGamePausedText()
 
     m_currentCoinsNbText->setPosition(0.09f * m_width, 0.115f * m_height);
     m_currentCoinsNbText->setFillColor(AppColor::CoinGold);
-    m_currentCoinsNbText->setUtf8String(to_string(m_appCore->getGameMap().at("coin_number")).append(" ")
-                                                + LocalizationManager::fetchLocalizedString("game_coins"));
+    m_currentCoinsNbText->setUtf8String(to_string(m_appCore->getGameValue(CURRENT_COINS)).append(" ")
+            + LocalizationManager::fetchLocalizedStringById(StringIds::GAME_COINS));
 
     m_flattenedEnemiesText->setPosition(0.09f * m_width, 0.18f * m_height);
     m_flattenedEnemiesText->setFillColor(AppColor::EnemyBlue);
-    m_flattenedEnemiesText->setUtf8String(to_string(m_appCore->getGameMap().at("enemies_destroyed")).append(" ")
-                                                  + LocalizationManager::fetchLocalizedString("game_flattened"));
+    m_flattenedEnemiesText->setUtf8String(to_string(m_appCore->getGameValue(CURRENT_ENEMIES_DESTROYED)).append(" ")
+            + LocalizationManager::fetchLocalizedStringById(StringIds::GAME_FLATTENED));
 }
 
 
@@ -433,7 +441,7 @@ void AppTextManager::syncGamePausedText()
  * @param gameSpeed the last game speed before game over
  *
  * @author Arthur
- * @date 02/04/16 - 13/01/19
+ * @date 02/04/16 - 17/10/2026
  */
 void AppTextManager::syncGameOverText(int gameSpeed)
 {
@@ -449,25 +457,25 @@ void AppTextManager::syncGameOverText(int gameSpeed)
     m_currentDistanceLabel->setFillColor(sf::Color::White);
     m_currentDistanceText->setPosition(0.65f * m_width, 0.345f * m_height);
     m_currentDistanceText->setFillColor(AppColor::ScoreGrey);
-    m_currentDistanceText->setString(to_string(m_appCore->getGameMap().at("distance")) + " m");
+    m_currentDistanceText->setString(to_string(m_appCore->getGameValue(CURRENT_DISTANCE)) + " m");
 
     m_currentCoinsLabel->setPosition(0.25f * m_width, 0.41f * m_height);
     m_currentCoinsNbText->setPosition(0.65f * m_width, 0.41f * m_height);
     m_currentCoinsNbText->setFillColor(AppColor::ScoreGrey);
-    m_currentCoinsNbText->setString(to_string(m_appCore->getGameMap().at("coin_number")) + "  X  20");
-    m_statsTotalCoinsNbText->setStringFromInt(m_appCore->getStatsMap().at("total_coins_collected"));
+    m_currentCoinsNbText->setString(to_string(m_appCore->getGameValue(CURRENT_COINS)) + "  X  20");
+    m_statsTotalCoinsNbText->setStringFromInt(m_appCore->getStatCounters().get(TOTAL_COINS_COLLECTED));
 
     m_flattenedEnemiesLabel->setPosition(0.25f * m_width, 0.48f * m_height);
     m_flattenedEnemiesLabel->setFillColor(sf::Color::White);
     m_flattenedEnemiesText->setPosition(0.65f * m_width, 0.48f * m_height);
     m_flattenedEnemiesText->setFillColor(AppColor::ScoreGrey);
-    m_flattenedEnemiesText->setStringFromInt(m_appCore->getGameMap().at("enemies_destroyed"));
+    m_flattenedEnemiesText->setStringFromInt(m_appCore->getGameValue(CURRENT_ENEMIES_DESTROYED));
 
     m_currentScoreLabel->setPosition(0.25f * m_width, 0.58f * m_height);
     m_currentScoreLabel->setFont(m_BoldFont);
     m_currentScoreText->setPosition(0.65f * m_width, 0.58f * m_height);
     m_currentScoreText->setFont(m_BoldFont);
-    m_currentScoreText->setStringFromInt(m_appCore->getGameMap().at("score"));
+    m_currentScoreText->setStringFromInt(m_appCore->getGameValue(CURRENT_SCORE));
 
     m_walletText->applyTextFont(ViewResources::ROBOTO_CONDENSED_FONT, DEFAULT_CHAR_SIZE, AppColor::CoinGold);
     m_walletText->setPosition(0.48f * m_width, 0.89f * m_height);
@@ -586,16 +594,24 @@ void AppTextManager::drawMenuShopText(sf::RenderWindow* window, unsigned int nbI
  * Draws running game standalone text
  *
  * @param window the app's window
+ * @return the number of draw calls
  *
  * @author Arthur
- * @date 02/04/16 - 02/01/17
+ * @date 02/04/16 - 17/10/2026
  */
-void AppTextManager::drawGameRunningText(sf::RenderWindow* window) const
+unsigned int AppTextManager::drawGameRunningText(sf::RenderWindow* window) const
 {
-    m_playerLifeLabel->draw(window);
-    m_currentDistanceLabel->draw(window);
-    m_currentDistanceText->draw(window);
-    m_bonusTimeoutText->draw(window);
+    unsigned int drawCallCount = 0;
+
+    for (const mdsf::Text* text : {m_playerLifeLabel, m_currentDistanceLabel,
+                                   m_currentDistanceText, m_bonusTimeoutText}) {
+        if (text->isVisible()) {
+            text->draw(window);
+            drawCallCount++;
+        }
+    }
+
+    return drawCallCount;
 }
 
 
@@ -34,7 +34,7 @@ namespace mdsf = Bokoblin::MaterialDesignComponentsForSFML;
  * Text objects branded as "Text" are loaded from parsed data
  *
  * @author Arthur
- * @date 02/04/16 - 13/01/19
+ * @date 02/04/16 - 17/10/2026
  */
 class AppTextManager
 {
@@ -47,6 +47,9 @@ public:
     //=== OPERATORS
     void operator=(AppTextManager const&) = delete;
 
+    //=== GETTERS
+    const sf::Font& getCondensedFont() const;
+
     //=== METHODS
     //Text utils
     void handleAboutLinks(const sf::Event& event) const; //TODO [MDC-CPP] Replace by a dedicated LinkButton class
@@ -68,7 +71,7 @@ public:
     //Text drawing
     void drawGameOverText(sf::RenderWindow* window) const;
     void drawGamePausedText(sf::RenderWindow* window) const;
-    void drawGameRunningText(sf::RenderWindow* window) const;
+    unsigned int drawGameRunningText(sf::RenderWindow* window) const;
     void drawMenuCommandsText(sf::RenderWindow* window) const;
     void drawMenuLeaderboardText(sf::RenderWindow* window) const;
     void drawMenuSettingsText(sf::RenderWindow* window, int currentPage) const;
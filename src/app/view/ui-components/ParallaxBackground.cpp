@@ -38,6 +38,18 @@ ScrollingBackground* ParallaxBackground::getBackground(unsigned int depth)
     return m_backgrounds.at(depth);
 }
 
+/**
+ * @brief Get the number of draw calls done by draw()
+ * @return two per scrolling background
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+unsigned int ParallaxBackground::getDrawCallCount() const
+{
+    return static_cast<unsigned int>(2 * m_backgrounds.size());
+}
+
 //------------------------------------------------
 //          METHODS
 //------------------------------------------------
@@ -25,7 +25,7 @@ limitations under the License.
  * that is having multiple scrolling backgrounds superposed.
  *
  * @author Arthur
- * @date 13/07/2019
+ * @date 13/07/2019 - 17/10/2026
  * 
  * @see ScrollingBackground
  */
@@ -39,6 +39,7 @@ public:
 
     //=== GETTERS
     ScrollingBackground* getBackground(unsigned int depth);
+    unsigned int getDrawCallCount() const;
 
     //=== METHODS
     void addBackground(int depth, float speed, const std::string& image);
@@ -0,0 +1,219 @@
+#include "PerformanceOverlay.h"
+
+#include <algorithm>
+#include <cstdio>
+
+constexpr unsigned int PerformanceOverlay::CHARACTER_SIZE;
+constexpr float PerformanceOverlay::PADDING;
+constexpr float PerformanceOverlay::LINE_HEIGHT;
+constexpr float PerformanceOverlay::BAR_WIDTH;
+constexpr float PerformanceOverlay::GRAPH_HEIGHT;
+
+namespace
+{
+const sf::Color BACKGROUND_COLOR(0, 0, 0, 170);
+const sf::Color TEXT_COLOR(255, 255, 255);
+const sf::Color BAR_COLOR(76, 175, 80);
+const sf::Color SLOW_BAR_COLOR(244, 67, 54);
+const sf::Color BUDGET_COLOR(255, 235, 59);
+const std::size_t LINE_COUNT = 6;
+}
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs a hidden performance overlay
+ *
+ * @param x the x-axis coordinate of the top left corner
+ * @param y the y-axis coordinate of the top left corner
+ * @param font the text font, that must outlive the overlay
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+PerformanceOverlay::PerformanceOverlay(float x, float y, const sf::Font& font) :
+        m_x{x}, m_y{y}, m_font(font), m_vertices(sf::Triangles), m_isVisible{false}
+{}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+bool PerformanceOverlay::isVisible() const { return m_isVisible; }
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+void PerformanceOverlay::toggle()
+{
+    m_isVisible = !m_isVisible;
+}
+
+/**
+ * @brief Rebuild the overlay's vertices from the last frames
+ * @details The frame rate is computed from recent frames durations,
+ * which are drawn as a bar graph with a line at the frame budget
+ *
+ * @param frameProfiler the profiler measuring frames, nullptr if not measured
+ * @param stats other displayed values
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void PerformanceOverlay::update(const FrameProfiler* frameProfiler, const PerformanceStats& stats)
+{
+    if (!m_isVisible) {
+        return;
+    }
+
+    const float width = FrameProfiler::RECENT_FRAME_COUNT * BAR_WIDTH + 2 * PADDING;
+    const float height = LINE_COUNT * LINE_HEIGHT + GRAPH_HEIGHT + 3 * PADDING;
+    char lines[LINE_COUNT][48];
+    double frameAverage = 0;
+    std::uint32_t maxFrameDuration = 0;
+    std::size_t frameCount = 0;
+
+    if (frameProfiler != nullptr) {
+        for (std::size_t age = 0; age < FrameProfiler::RECENT_FRAME_COUNT; age++) {
+            const std::uint32_t duration = frameProfiler->getRecentFrameDuration(age);
+            if (duration > 0) {
+                frameAverage += duration;
+                maxFrameDuration = std::max(maxFrameDuration, duration);
+                frameCount++;
+            }
+        }
+        frameAverage = frameCount > 0 ? frameAverage / frameCount : 0;
+    }
+
+    std::snprintf(lines[0], sizeof(lines[0]), "FPS: %.1f", frameAverage > 0 ? 1000000 / frameAverage : 0.);
+    std::snprintf(lines[1], sizeof(lines[1]), "Frame: %.2f ms (max %.2f ms)",
+                  frameAverage / 1000, maxFrameDuration / 1000.);
+    std::snprintf(lines[2], sizeof(lines[2]), "Step: %.3f ms",
+                  frameProfiler != nullptr ? frameProfiler->getLastDuration(PHASE_NEXT_STEP) / 1000. : 0.);
+    std::snprintf(lines[3], sizeof(lines[3]), "Elements: %lu", static_cast<unsigned long>(stats.liveElementCount));
+    std::snprintf(lines[4], sizeof(lines[4]), "Draw calls: %u", stats.drawCallCount);
+    std::snprintf(lines[5], sizeof(lines[5]), "Textures: %.1f MB", stats.textureBytes / (1024. * 1024.));
+
+    m_vertices.clear();
+    appendRectangle(m_x, m_y, width, height, BACKGROUND_COLOR);
+
+    for (std::size_t i = 0; i < LINE_COUNT; i++) {
+        appendText(m_x + PADDING, m_y + PADDING + (i + 1) * LINE_HEIGHT - 4, lines[i], TEXT_COLOR);
+    }
+
+    //=== Frame time graph, the most recent frame on the right
+
+    if (frameProfiler != nullptr) {
+        const float graphBottom = m_y + height - PADDING;
+        const float scale = GRAPH_HEIGHT / std::max(maxFrameDuration, 2 * frameProfiler->getFrameBudget());
+
+        for (std::size_t age = 0; age < frameCount; age++) {
+            const std::uint32_t duration = frameProfiler->getRecentFrameDuration(age);
+            const float barHeight = std::max(1.f, duration * scale);
+            const float barX = m_x + PADDING + (FrameProfiler::RECENT_FRAME_COUNT - 1 - age) * BAR_WIDTH;
+            appendRectangle(barX, graphBottom - barHeight, BAR_WIDTH, barHeight,
+                            duration > frameProfiler->getFrameBudget() ? SLOW_BAR_COLOR : BAR_COLOR);
+        }
+
+        const float budgetHeight = frameProfiler->getFrameBudget() * scale;
+        appendRectangle(m_x + PADDING, graphBottom - budgetHeight,
+                        FrameProfiler::RECENT_FRAME_COUNT * BAR_WIDTH, 1, BUDGET_COLOR);
+    }
+}
+
+/**
+ * @brief Draw the overlay with a single draw call
+ *
+ * @param target the render target
+ * @param states the render states
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void PerformanceOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (m_isVisible && m_vertices.getVertexCount() > 0) {
+        states.texture = &m_font.getTexture(CHARACTER_SIZE);
+        target.draw(m_vertices, states);
+    }
+}
+
+/**
+ * @brief Append a quad as two triangles
+ *
+ * @param area the quad's area
+ * @param textureArea the quad's texture area, in pixels
+ * @param color the quad's color
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void PerformanceOverlay::appendQuad(const sf::FloatRect& area, const sf::FloatRect& textureArea,
+                                    const sf::Color& color)
+{
+    const float right = area.left + area.width;
+    const float bottom = area.top + area.height;
+    const float textureRight = textureArea.left + textureArea.width;
+    const float textureBottom = textureArea.top + textureArea.height;
+
+    const sf::Vertex topLeft({area.left, area.top}, color, {textureArea.left, textureArea.top});
+    const sf::Vertex topRight({right, area.top}, color, {textureRight, textureArea.top});
+    const sf::Vertex bottomLeft({area.left, bottom}, color, {textureArea.left, textureBottom});
+    const sf::Vertex bottomRight({right, bottom}, color, {textureRight, textureBottom});
+
+    m_vertices.append(topLeft);
+    m_vertices.append(topRight);
+    m_vertices.append(bottomLeft);
+    m_vertices.append(bottomLeft);
+    m_vertices.append(topRight);
+    m_vertices.append(bottomRight);
+}
+
+/**
+ * @brief Append an untextured rectangle
+ * @details The font texture has a white 2x2 square at its origin,
+ * so sampling its center gives the plain vertex color
+ *
+ * @param x the x-axis coordinate
+ * @param y the y-axis coordinate
+ * @param width the width
+ * @param height the height
+ * @param color the color
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void PerformanceOverlay::appendRectangle(float x, float y, float width, float height, const sf::Color& color)
+{
+    appendQuad({x, y, width, height}, {1, 1, 0, 0}, color);
+}
+
+/**
+ * @brief Append the glyphs of a text
+ *
+ * @param x the x-axis coordinate of the text start
+ * @param y the y-axis coordinate of the text baseline
+ * @param text the text
+ * @param color the color
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void PerformanceOverlay::appendText(float x, float y, const char* text, const sf::Color& color)
+{
+    for (const char* character = text; *character != '\0'; character++) {
+        const sf::Glyph& glyph = m_font.getGlyph(static_cast<sf::Uint8>(*character), CHARACTER_SIZE, false);
+        const sf::FloatRect textureArea(glyph.textureRect);
+
+        if (glyph.bounds.width > 0) {
+            appendQuad({x + glyph.bounds.left, y + glyph.bounds.top, glyph.bounds.width, glyph.bounds.height},
+                       textureArea, color);
+        }
+        x += glyph.advance;
+    }
+}
@@ -0,0 +1,90 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef PERFORMANCE_OVERLAY_H
+#define PERFORMANCE_OVERLAY_H
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include "app/model/profiling/FrameProfiler.h"
+
+/**
+ * @struct PerformanceStats
+ * @details Values displayed by the performance overlay
+ * that don't come from the frame profiler
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct PerformanceStats
+{
+    std::size_t liveElementCount;
+    unsigned int drawCallCount;
+    std::size_t textureBytes;
+};
+
+
+/**
+ * The PerformanceOverlay class displays performance values
+ * over the game: frame rate, frame time graph, step time,
+ * live elements, draw calls and texture memory.
+ *
+ * Its text glyphs, background and graph bars are all quads of a single
+ * vertex array textured by the font's glyph texture, untextured quads using
+ * the font's white pixel, so that the overlay is drawn with one draw call.
+ * The vertex array is only rebuilt by update() while the overlay is visible.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class PerformanceOverlay: public sf::Drawable
+{
+public:
+    //=== CTORs / DTORs
+    PerformanceOverlay(float x, float y, const sf::Font& font);
+    PerformanceOverlay(const PerformanceOverlay&) = delete;
+    PerformanceOverlay& operator=(const PerformanceOverlay&) = delete;
+
+    //=== GETTERS
+    bool isVisible() const;
+
+    //=== METHODS
+    void toggle();
+    void update(const FrameProfiler* frameProfiler, const PerformanceStats& stats);
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    //=== ATTRIBUTES
+    static constexpr unsigned int CHARACTER_SIZE = 13;
+    static constexpr float PADDING = 8;
+    static constexpr float LINE_HEIGHT = 17;
+    static constexpr float BAR_WIDTH = 2;
+    static constexpr float GRAPH_HEIGHT = 48;
+
+    const float m_x;
+    const float m_y;
+    const sf::Font& m_font;
+    sf::VertexArray m_vertices;
+    bool m_isVisible;
+
+    //=== METHODS
+    void appendQuad(const sf::FloatRect& area, const sf::FloatRect& textureArea, const sf::Color& color);
+    void appendRectangle(float x, float y, float width, float height, const sf::Color& color);
+    void appendText(float x, float y, const char* text, const sf::Color& color);
+};
+
+#endif
@@ -19,6 +19,7 @@ limitations under the License.
 #include <string>
 #include "libs/Logger/Logger.h"
 #include "app/localization/LocalizationManager.h"
+#include "app/localization/LocalizedStringIds.h"
 #include "app/view/ui-components/ShopDialog.h"
 
 namespace sl = Bokoblin::SimpleLogger;
@@ -40,7 +41,7 @@ public:
      * @param dialog the concerned dialog
      *
      * @author Arthur
-     * @date 16/04/17 - 11/02/18
+     * @date 16/04/17 - 17/10/2026
      */
     static void retrieveCorrespondingStrings(mdsf::Dialog* dialog)
     {
@@ -52,30 +53,34 @@ public:
 
             if (dialog->getContext() == "shop_item_details") {
                 ShopDialog* shopDialog = dynamic_cast<ShopDialog*>(dialog);
-                utf8_dialog_title = LocalizationManager::fetchLocalizedString("shop_dialog_title");
-                utf8_dialog_content = LocalizationManager::fetchLocalizedString("shop_dialog_content");
+                utf8_dialog_title = LocalizationManager::fetchLocalizedStringById(StringIds::SHOP_DIALOG_TITLE);
+                utf8_dialog_content = LocalizationManager::fetchLocalizedStringById(StringIds::SHOP_DIALOG_CONTENT);
                 utf8_dialog_content.replace(utf8_dialog_content.find("$NAME"), 5,
                                             shopDialog->getLinkedShopItem()->getName());
                 utf8_dialog_content.replace(utf8_dialog_content.find("$PRICE"), 6,
                                             std::to_string(shopDialog->getLinkedShopItem()->getPrice()));
-                utf8_dialog_cancel = LocalizationManager::fetchLocalizedString("dialog_cancel");
-                utf8_dialog_ok = LocalizationManager::fetchLocalizedString("dialog_ok");
+                utf8_dialog_cancel = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_CANCEL);
+                utf8_dialog_ok = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_OK);
             } else if (dialog->getContext() == "shop_buying_success") {
-                utf8_dialog_content = LocalizationManager::fetchLocalizedString("shop_dialog_success");
-                utf8_dialog_ok = LocalizationManager::fetchLocalizedString("dialog_ok");
+                utf8_dialog_content = LocalizationManager::fetchLocalizedStringById(StringIds::SHOP_DIALOG_SUCCESS);
+                utf8_dialog_ok = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_OK);
             } else if (dialog->getContext() == "shop_buying_failure") {
-                utf8_dialog_content = LocalizationManager::fetchLocalizedString("shop_dialog_failure");
-                utf8_dialog_ok = LocalizationManager::fetchLocalizedString("dialog_ok");
+                utf8_dialog_content = LocalizationManager::fetchLocalizedStringById(StringIds::SHOP_DIALOG_FAILURE);
+                utf8_dialog_ok = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_OK);
             } else if (dialog->getContext() == "confirm_data_delete") {
-                utf8_dialog_title = LocalizationManager::fetchLocalizedString("confirm_data_delete_dialog_title");
-                utf8_dialog_content = LocalizationManager::fetchLocalizedString("confirm_data_delete_dialog_content");
-                utf8_dialog_cancel = LocalizationManager::fetchLocalizedString("dialog_cancel");
-                utf8_dialog_ok = LocalizationManager::fetchLocalizedString("dialog_ok");
+                utf8_dialog_title =
+                        LocalizationManager::fetchLocalizedStringById(StringIds::CONFIRM_DATA_DELETE_DIALOG_TITLE);
+                utf8_dialog_content =
+                        LocalizationManager::fetchLocalizedStringById(StringIds::CONFIRM_DATA_DELETE_DIALOG_CONTENT);
+                utf8_dialog_cancel = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_CANCEL);
+                utf8_dialog_ok = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_OK);
             } else if (dialog->getContext() == "confirm_leaderboard_delete") {
-                utf8_dialog_title = LocalizationManager::fetchLocalizedString("confirm_leaderboard_delete_dialog_title");
-                utf8_dialog_content = LocalizationManager::fetchLocalizedString("confirm_leaderboard_delete_dialog_content");
-                utf8_dialog_cancel = LocalizationManager::fetchLocalizedString("dialog_cancel");
-                utf8_dialog_ok = LocalizationManager::fetchLocalizedString("dialog_ok");
+                utf8_dialog_title =
+                        LocalizationManager::fetchLocalizedStringById(StringIds::CONFIRM_LEADERBOARD_DELETE_DIALOG_TITLE);
+                utf8_dialog_content =
+                        LocalizationManager::fetchLocalizedStringById(StringIds::CONFIRM_LEADERBOARD_DELETE_DIALOG_CONTENT);
+                utf8_dialog_cancel = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_CANCEL);
+                utf8_dialog_ok = LocalizationManager::fetchLocalizedStringById(StringIds::DIALOG_OK);
             }
 
             dialog->setTitleText(sf::String::fromUtf8(utf8_dialog_title.begin(), utf8_dialog_title.end()));
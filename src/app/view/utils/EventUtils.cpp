@@ -69,6 +69,19 @@ bool EventUtils::wasKeyboardEscapePressed(const sf::Event& event)
 }
 
 
+/**
+ * Tests if the key showing or hiding the performance overlay was pressed
+ * @return true, if action was triggered
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool EventUtils::wasKeyboardOverlayTogglePressed(const sf::Event& event)
+{
+    return event.type == sf::Event::KeyReleased && event.key.code == sf::Keyboard::F3;
+}
+
+
 /**
  * Tests if the mouse left button was pressed
  * @return true, if action was triggered 
@@ -27,7 +27,7 @@ namespace mdsf = Bokoblin::MaterialDesignComponentsForSFML;
  * The EventUtils class defines simple events accessible to the application.
  *
  * @author Arthur
- * @date 30/10/2018 - 13/01/19
+ * @date 30/10/2018 - 17/10/2026
  */
 class EventUtils
 {
@@ -38,6 +38,7 @@ public:
     static bool wasKeyboardJumpPressed();
     static bool wasKeyboardContinuePressed();
     static bool wasKeyboardEscapePressed(const sf::Event& event);
+    static bool wasKeyboardOverlayTogglePressed(const sf::Event& event);
     static bool wasMouseLeftPressed(const sf::Event& event);
     static bool wasMouseReleased(const sf::Event& event);
     static bool isMouseInside(const mdsf::Sprite& sprite, const sf::Event& event);
@@ -14,10 +14,10 @@ namespace ViewResources = Bokoblin::BokoRunner::Resources::View;
  * @param textManager a text manager
  *
  * @author Arthur, Florian
- * @date 29/01/17
+ * @date 29/01/17 - 17/10/2026
  */
 AbstractView::AbstractView(sf::RenderWindow* window, AppTextManager* textManager) :
-        m_window{window}, m_textManager{textManager}
+        m_window{window}, m_textManager{textManager}, m_frameProfiler{nullptr}
 {
     m_width = m_window->getSize().x;
     m_height = m_window->getSize().y;
@@ -43,6 +43,18 @@ unsigned int AbstractView::getHalfYPosition() const
     return m_height / 2;
 }
 
+/**
+ * Set the profiler measuring the sub-phases of the view's frames
+ * @param frameProfiler the profiler, nullptr to measure nothing
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void AbstractView::setFrameProfiler(FrameProfiler* frameProfiler)
+{
+    m_frameProfiler = frameProfiler;
+}
+
 
 /**
  * Destructor
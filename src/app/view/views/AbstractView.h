@@ -20,6 +20,7 @@ limitations under the License.
 #include <SFML/System/Sleep.hpp>
 #include "libs/MDC-SFML/src/Color.h"
 #include "libs/MDC-SFML/src/Button.h"
+#include "app/model/profiling/FrameProfiler.h"
 #include "app/persistence/PersistenceManager.h"
 #include "app/view/AppTextManager.h"
 #include "app/view/ui-components/AnimatedSprite.h"
@@ -32,7 +33,7 @@ limitations under the License.
  * that will be used by its inherited classes.
  *
  * @author Arthur, Florian
- * @date 21/02/2016 - 13/01/2019
+ * @date 21/02/2016 - 17/10/2026
  */
 class AbstractView
 {
@@ -48,12 +49,14 @@ public:
     virtual bool handleEvents(sf::Event& event) = 0;
     unsigned int getHalfXPosition() const;
     unsigned int getHalfYPosition() const;
+    void setFrameProfiler(FrameProfiler* frameProfiler);
 
 protected:
     //=== ATTRIBUTES
     unsigned int m_width, m_height;
     sf::RenderWindow* m_window;
     AppTextManager* m_textManager;
+    FrameProfiler* m_frameProfiler;
 
     //Constants
     const int DEFAULT_HOME_SIZE = 50;
@@ -1,4 +1,5 @@
 #include "GameView.h"
+#include "libs/Logger/Tracer.h"
 
 namespace ViewResources = Bokoblin::BokoRunner::Resources::View;
 
@@ -10,12 +11,16 @@ namespace ViewResources = Bokoblin::BokoRunner::Resources::View;
  * @brief Link a model movable element to new sprite matching its type
  *
  * @author Arthur
- * @date 18/03/2016 - 24/12/2017
+ * @date 18/03/2016 - 17/10/2026
  */
 void GameView::linkElements()
 {
-    for (auto& element : m_game->getNewMElementsArray()) {
-        m_movableElementToSpriteMap[element] = new AnimatedSprite(*(m_typeToSpriteMap[element->getType()]));
+    TRACE_SCOPE("view", "GameView::linkElements");
+    for (const ElementHandle& handle : m_game->getNewMElementsArray()) {
+        if (m_game->isMovableElementAlive(handle)) {
+            const MovableElementType type = m_game->getMovableElement(handle).getType();
+            m_movableElementToSpriteMap[handle] = new AnimatedSprite(*(m_typeToSpriteMap[type]));
+        }
     }
 
     m_game->clearNewMovableElementList();
@@ -25,10 +30,11 @@ void GameView::linkElements()
  * @brief Process the transition between zones
  *
  * @author Arthur
- * @date 25/04/2016 - 14/07/2019
+ * @date 25/04/2016 - 17/10/2026
  */
 void GameView::processZonesTransition()
 {
+    TRACE_SCOPE("view", "GameView::processZonesTransition");
     //=== [Always] Set background speed and position
 
     m_farTransitionBackground->setPosition(m_farTransitionBackground->getX() - TRANSITION_SPEED, 0);
@@ -91,10 +97,11 @@ void GameView::processZonesTransition()
 * @brief Setup the transition between zones
 *
 * @author Arthur
-* @date 25/04/2016 - 13/07/2019
+* @date 25/04/2016 - 17/10/2026
 */
 void GameView::setupTransition()
 {
+    TRACE_SCOPE("view", "GameView::setupTransition");
     m_game->setTransitionState(true);
     m_xPixelIntensity = 1;
     m_yPixelIntensity = 1;
@@ -112,9 +119,11 @@ void GameView::setupTransition()
 
 /**
  * @brief Update elements of a running game
+ * @details Elements are moved by the model, sprites are placed
+ * by interpolating between the two last simulation steps
  *
  * @author Arthur
- * @date 6/03/2016 - 13/07/2019
+ * @date 6/03/2016 - 17/10/2026
  */
 void GameView::updateRunningGameElements()
 {
@@ -139,15 +148,16 @@ void GameView::updateRunningGameElements()
 
     m_remainingLifeImage->resize(0.01f * LIFE_LEVEL_WIDTH * m_game->getPlayer()->getLife(), LIFE_LEVEL_HEIGHT);
 
-    for (auto& it : m_movableElementToSpriteMap) {
-        m_game->moveMovableElement(it.first);
+    const float alpha = m_game->getInterpolationFactor();
 
-        float position_x = (it.first)->getPosX();
-        float position_y = (it.first)->getPosY();
+    for (auto& it : m_movableElementToSpriteMap) {
+        const MovableElement element = m_game->getMovableElement(it.first);
+        float position_x = element.getInterpolatedPosX(alpha);
+        float position_y = element.getInterpolatedPosY(alpha);
 
         it.second->setPosition(position_x, position_y);
         it.second->sync();
-        it.second->resize(it.first->getWidth(), it.first->getHeight());
+        it.second->resize(element.getWidth(), element.getHeight());
     }
 
     //=== Update shield sprite
@@ -159,81 +169,122 @@ void GameView::updateRunningGameElements()
             m_shieldImage->setTextureRect(sf::IntRect(50, 0, 50, 50));
         }
 
-        m_shieldImage->setPosition(m_game->getPlayer()->getPosX() - 5, m_game->getPlayer()->getPosY() + 5);
+        m_shieldImage->setPosition(m_game->getPlayer()->getInterpolatedPosX(alpha) - 5,
+                                   m_game->getPlayer()->getInterpolatedPosY(alpha) + 5);
         m_shieldImage->resize(SHIELD_SIZE);
     }
 }
 
 /**
- * @brief Deletes the Sprite that collided with the player
- * @details We consider that the player only collide with one element per complete loop,
- * it allows to reduce average complexity instead doing n loops each time (worst case)
+ * @brief Deletes the Sprites of elements that collided with the player or were removed from the game
+ * @details Collisions are taken from the game's events since last frame,
+ * all of them being handled, without scanning sprites
  *
  * @author Arthur
- * @date 12/03/2016 - 20/03/2016
+ * @date 12/03/2016 - 17/10/2026
  */
 void GameView::deleteElements()
 {
-    auto it = m_movableElementToSpriteMap.begin();
-    bool found = false;
-
-    while (!found && it != m_movableElementToSpriteMap.end()) {
-        if ((it->first)->isColliding()) {
-            if ((it->first)->getType() == COIN) {
-                m_coinMusic.play();
-            }
-
-            if ((it->first)->getType() == STANDARD_ENEMY
-                    || (it->first)->getType() == TOTEM_ENEMY
-                    || (it->first)->getType() == BLOCK_ENEMY) {
-                m_destructedEnemiesMusic.play();
-            }
+    TRACE_SCOPE("view", "GameView::deleteElements");
+    //=== Elements removed from the game since last frame
 
+    for (const ElementRemoval& removal : m_game->getRemovedMElementsArray()) {
+        auto it = m_movableElementToSpriteMap.find(removal.handle);
+        if (it != m_movableElementToSpriteMap.end()) {
             delete it->second;
             m_movableElementToSpriteMap.erase(it);
-            found = true;
-        } else {
-            ++it;
+        }
+    }
+
+    m_game->clearRemovedMovableElementList();
+
+    //=== Elements still in game but that collided with the player
+
+    GameEvent event;
+    while (m_game->getEventBuffer().poll(m_eventCursor, event)) {
+        if (event.type == COIN_COLLECTED || event.type == ENEMY_FLATTENED
+                || event.type == ENEMY_HIT || event.type == BONUS_ACTIVATED) {
+            playCollisionSound(event.elementType);
+
+            auto it = m_movableElementToSpriteMap.find(event.handle);
+            if (it != m_movableElementToSpriteMap.end()) {
+                delete it->second;
+                m_movableElementToSpriteMap.erase(it);
+            }
         }
     }
 }
 
+/**
+ * @brief Play the sound matching a collided element type
+ *
+ * @param type the type of the collided element
+ *
+ * @author Arthur
+ * @date 12/03/2016 - 17/10/2026
+ */
+void GameView::playCollisionSound(const MovableElementType& type)
+{
+    if (type == COIN) {
+        m_coinMusic.play();
+    }
+
+    if (type == STANDARD_ENEMY || type == TOTEM_ENEMY || type == BLOCK_ENEMY) {
+        m_destructedEnemiesMusic.play();
+    }
+}
+
 /**
  * @brief Draw elements of a running game
+ * @details The number of draw calls is kept for the performance overlay,
+ * which is drawn last, over the game
  *
  * @author Arthur
- * @date 24/12/2017 - 13/07/2019
+ * @date 24/12/2017 - 17/10/2026
  */
 void GameView::drawRunningGame() const
 {
+    unsigned int drawCallCount = 0;
+
     //=== Standalone Sprites drawing
 
     m_parallaxBackground->draw(m_window);
+    drawCallCount += m_parallaxBackground->getDrawCallCount();
 
     if (m_game->isTransitionRunning()) {
         m_window->draw(*m_farTransitionBackground);
+        drawCallCount++;
         if (m_farTransitionBackground->getX() < getHalfXPosition()) {
             m_window->draw(*m_pixelShader);
+            drawCallCount++;
         }
     }
 
     m_window->draw(*m_bottomBarImage);
     m_window->draw(*m_remainingLifeImage);
     m_window->draw(*m_lifeBoxImage);
+    drawCallCount += 3;
 
     //=== Array's Sprites drawing
 
     for (const auto& it : m_movableElementToSpriteMap) {
         it.second->draw(m_window);
     }
+    drawCallCount += static_cast<unsigned int>(m_movableElementToSpriteMap.size());
 
     if (m_game->getPlayer()->getState() == SHIELDED || m_game->getPlayer()->getState() == HARD_SHIELDED) {
         m_window->draw(*m_shieldImage);
+        drawCallCount++;
     }
 
     //=== Standalone Text drawing
 
-    m_textManager->drawGameRunningText(m_window);
+    drawCallCount += m_textManager->drawGameRunningText(m_window);
+    m_drawCallCount = drawCallCount;
+
+    //=== Performance overlay drawing
+
+    m_window->draw(*m_performanceOverlay);
 }
 
 /**
@@ -243,12 +294,14 @@ void GameView::drawRunningGame() const
  * @return true if app state is unchanged
  *
  * @author Arthur
- * @date 26/12/2017 - 13/01/2019
+ * @date 26/12/2017 - 17/10/2026
  */
 bool GameView::handleRunningGameEvents(const sf::Event& event)
 {
-    if (event.type == sf::Event::KeyReleased) {
-        m_game->getPlayer()->decelerate();
+    if (EventUtils::wasKeyboardOverlayTogglePressed(event)) {
+        m_performanceOverlay->toggle();
+    } else if (event.type == sf::Event::KeyReleased) {
+        m_game->requestPlayerDeceleration();
     }
     return true;
 }
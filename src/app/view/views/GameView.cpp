@@ -1,5 +1,6 @@
 #include "GameView.h"
 #include "libs/MDC-SFML/src/ClipRectUtils.h"
+#include "libs/Logger/Tracer.h"
 
 using std::string;
 using std::vector;
@@ -18,14 +19,17 @@ namespace ViewRes = Bokoblin::BokoRunner::Resources::View;
  * @param gameModel the game model counterpart
  *
  * @author Arthur
- * @date 26/03/2016 - 11/09/2018
+ * @date 26/03/2016 - 17/10/2026
  */
 GameView::GameView(sf::RenderWindow* window, AppTextManager* textManager, GameModel* gameModel) :
         AbstractView(window, textManager), m_game{gameModel},
-        m_xPixelIntensity{INITIAL_PIXEL_INTENSITY}, m_yPixelIntensity{INITIAL_PIXEL_INTENSITY}
+        m_xPixelIntensity{INITIAL_PIXEL_INTENSITY}, m_yPixelIntensity{INITIAL_PIXEL_INTENSITY},
+        m_drawCallCount{0}, m_eventCursor(gameModel->getEventBuffer().createCursor())
 {
     GameView::loadSprites();
     m_pixelShader = new PixelShader();
+    m_performanceOverlay = new PerformanceOverlay(PERFORMANCE_OVERLAY_X, PERFORMANCE_OVERLAY_Y,
+            m_textManager->getCondensedFont());
 
     //=== change default game music if in master mode
 
@@ -34,7 +38,7 @@ GameView::GameView(sf::RenderWindow* window, AppTextManager* textManager, GameMo
             : ViewRes::GAME_MUSIC_THEME_HARD_MODE;
 
     if (!m_gameThemeMusic.openFromFile(game_music)) {
-        Logger::printError("Music loading failed for \"" + game_music + "\"");
+        Logger::printError("Music loading failed for \"", game_music, '"');
     } else {
         handleMusic();
         m_gameThemeMusic.play();
@@ -42,11 +46,11 @@ GameView::GameView(sf::RenderWindow* window, AppTextManager* textManager, GameMo
     }
 
     if (!m_coinMusic.openFromFile(ViewRes::COINS_COLLECTED_MUSIC)) {
-        Logger::printError("Music loading failed for \"" + ViewRes::COINS_COLLECTED_MUSIC + "\"");
+        Logger::printError("Music loading failed for \"", ViewRes::COINS_COLLECTED_MUSIC, '"');
     }
 
     if (!m_destructedEnemiesMusic.openFromFile(ViewRes::ENEMIES_DESTRUCTED_MUSIC)) {
-        Logger::printError("Music loading failed for \"" + ViewRes::ENEMIES_DESTRUCTED_MUSIC + "\"");
+        Logger::printError("Music loading failed for \"", ViewRes::ENEMIES_DESTRUCTED_MUSIC, '"');
     }
 }
 
@@ -54,7 +58,7 @@ GameView::GameView(sf::RenderWindow* window, AppTextManager* textManager, GameMo
  * @brief Destructor
  *
  * @author Arthur
- * @date 26/03/2016 - 13/07/2019
+ * @date 26/03/2016 - 17/10/2026
  */
 GameView::~GameView()
 {
@@ -67,6 +71,7 @@ GameView::~GameView()
     delete m_remainingLifeImage;
     delete m_shieldImage;
     delete m_pixelShader;
+    delete m_performanceOverlay;
     for (auto& it : m_typeToSpriteMap) {
         delete it.second;
     }
@@ -98,10 +103,11 @@ GameView::~GameView()
  * @brief Load all sprites used by the game (backgrounds, UI, elements)
  *
  * @author Arthur
- * @date 26/03/2016 - 03/05/2020
+ * @date 26/03/2016 - 17/10/2026
  */
 void GameView::loadSprites()
 {
+    TRACE_SCOPE("view", "GameView::loadSprites");
     //=== Initialize backgrounds
 
     m_parallaxBackground = new ParallaxBackground(1.33f * m_width, m_height);
@@ -226,17 +232,26 @@ void GameView::loadSprites()
  * @brief Synchronize game elements
  *
  * @author Arthur
- * @date 26/03/2016 - 30/01/2017
+ * @date 26/03/2016 - 17/10/2026
  */
 void GameView::synchronize()
 {
+    TRACE_SCOPE("view", "GameView::synchronize");
     switch (m_game->getGameState()) {
         case RUNNING :
         case RUNNING_SLOWLY :
-            linkElements();
+            {
+                PhaseTimer timer(m_frameProfiler, PHASE_LINK_ELEMENTS);
+                linkElements();
+            }
             deleteElements();
-            updateRunningGameElements();
+            {
+                PhaseTimer timer(m_frameProfiler, PHASE_UPDATE_ELEMENTS);
+                updateRunningGameElements();
+            }
             m_textManager->syncGameRunningText(m_game->getBonusTimeout());
+            m_performanceOverlay->update(m_frameProfiler, {m_game->getLiveElementsCount(), m_drawCallCount,
+                    mdsf::Sprite::getLoadedTextureBytes()});
             break;
         case PAUSED:
             updatePausedGameElements();
@@ -261,17 +276,20 @@ void GameView::synchronize()
  * @brief Draw game elements on the window
  *
  * @author Arthur
- * @date 26/03/2016 - 24/12/2017
+ * @date 26/03/2016 - 17/10/2026
  */
 void GameView::draw() const
 {
+    TRACE_SCOPE("view", "GameView::draw");
     m_window->clear();
 
     switch (m_game->getGameState()) {
         case RUNNING :
-        case RUNNING_SLOWLY :
+        case RUNNING_SLOWLY : {
+            PhaseTimer timer(m_frameProfiler, PHASE_DRAW_RUNNING_GAME);
             drawRunningGame();
             break;
+        }
         case PAUSED:
             drawPausedGame();
             break;
@@ -282,6 +300,7 @@ void GameView::draw() const
             break;
     }
 
+    PhaseTimer timer(m_frameProfiler, PHASE_DISPLAY);
     m_window->display();
 }
 
@@ -308,9 +327,10 @@ void GameView::handleMusic()
 
 /**
  * @brief Handle players inputs
+ * @details Inputs are forwarded to the model which applies them on its own simulation steps
  *
  * @author Arthur
- * @date 26/12/2017 - 30/10/2018
+ * @date 26/12/2017 - 17/10/2026
  */
 void GameView::handlePlayerInput() const
 {
@@ -318,15 +338,19 @@ void GameView::handlePlayerInput() const
             m_game->getGameState() == RUNNING_SLOWLY) {
         //=== Player Controls in Game Screen
 
+        unsigned int input = INPUT_NONE;
+
         if (EventUtils::wasKeyboardLeftPressed()) {
-            m_game->getPlayer()->controlPlayerMovements(MOVE_LEFT);
+            input |= INPUT_LEFT;
         } else if (EventUtils::wasKeyboardRightPressed()) {
-            m_game->getPlayer()->controlPlayerMovements(MOVE_RIGHT);
+            input |= INPUT_RIGHT;
         }
 
         if (EventUtils::wasKeyboardJumpPressed()) {
-            m_game->getPlayer()->jump();
+            input |= INPUT_JUMP;
         }
+
+        m_game->setPlayerInput(input);
     }
 }
 
@@ -337,10 +361,11 @@ void GameView::handlePlayerInput() const
  * @return true if app state is unchanged
  *
  * @author Arthur, Florian
- * @date 21/02/2016 - 13/01/2019
+ * @date 21/02/2016 - 17/10/2026
  */
 bool GameView::handleEvents(sf::Event& event)
 {
+    TRACE_SCOPE("view", "GameView::handleEvents");
     handlePlayerInput();
 
     while (m_window->pollEvent(event)) {
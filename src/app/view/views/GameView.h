@@ -22,12 +22,13 @@ limitations under the License.
 #include "app/view/ui-components/PixelShader.h"
 #include "AbstractView.h"
 #include "app/view/ui-components/ParallaxBackground.h"
+#include "app/view/ui-components/PerformanceOverlay.h"
 
 /**
  * @class GameView
  *
  * @author Arthur, Florian
- * @date 21/02/16 - 02/05/2020
+ * @date 21/02/16 - 17/10/2026
  */
 class GameView: public AbstractView
 {
@@ -47,6 +48,7 @@ private:
     PixelShader* m_pixelShader;
     float m_xPixelIntensity;
     float m_yPixelIntensity;
+    mutable unsigned int m_drawCallCount;
 
     //Constants
     const unsigned int SCROLLING_BACKGROUND = 0;
@@ -68,6 +70,8 @@ private:
     const int LIFE_BOX_HEIGHT = 100;
     const int LIFE_LEVEL_WIDTH = 300;
     const int LIFE_LEVEL_HEIGHT = 50;
+    const float PERFORMANCE_OVERLAY_X = 10;
+    const float PERFORMANCE_OVERLAY_Y = 10;
     static constexpr float INITIAL_PIXEL_INTENSITY = 1;
 
     //Game Graphic Elements
@@ -77,6 +81,7 @@ private:
     mdsf::Sprite* m_lifeBoxImage;
     mdsf::Sprite* m_remainingLifeImage;
     mdsf::Sprite* m_shieldImage;
+    PerformanceOverlay* m_performanceOverlay;
 
     //Pause and End Graphic Elements
     mdsf::Sprite* m_pauseBackground;
@@ -97,7 +102,8 @@ private:
 
     //Containers
     std::map<MovableElementType, AnimatedSprite*> m_typeToSpriteMap;
-    std::map<MovableElement*, AnimatedSprite*> m_movableElementToSpriteMap;
+    std::map<ElementHandle, AnimatedSprite*> m_movableElementToSpriteMap;
+    GameEventCursor m_eventCursor;
 
     //=== METHODS
 
@@ -122,6 +128,7 @@ private:
 
     //Audio
     void handleMusic();
+    void playCollisionSound(const MovableElementType& type);
 
     //Events
     void handlePlayerInput() const;
@@ -51,12 +51,12 @@ MenuView::~MenuView()
  * @brief Load the menu music at startup
  *
  * @author Arthur
- * @date 29/12/2017
+ * @date 29/12/2017 - 17/10/2026
  */
 void MenuView::loadMusic()
 {
     if (!m_menuMusic.openFromFile(ViewResources::MENU_MUSIC_THEME)) {
-        Logger::printError("Music loading failed for \"" + ViewResources::MENU_MUSIC_THEME + "\"");
+        Logger::printError("Music loading failed for \"", ViewResources::MENU_MUSIC_THEME, '"');
     } else {
         if (m_menu->isMusicEnabled()) {
             m_menuMusic.setVolume(100);
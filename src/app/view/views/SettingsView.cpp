@@ -248,10 +248,11 @@ void SettingsView::draw() const
  * Updates all text based components
  * or components that uses text (e.g. buttons, dialogs).
  * This function is meant to be used only by some
- * event triggers (those which change language) to minimize disk access.
+ * event triggers (those which change language),
+ * strings coming from the preloaded language catalogs.
  *
  * @author Arthur
- * @date 02/01/18
+ * @date 02/01/18 - 17/10/2026
  */
 void SettingsView::updateTextBasedComponents() const
 {
@@ -0,0 +1,133 @@
+#include "LogQueue.h"
+
+#include <cstring>
+
+namespace Bokoblin
+{
+namespace SimpleLogger
+{
+
+constexpr std::size_t LogRecord::TEXT_CAPACITY;
+
+namespace
+{
+const char TRUNCATION_MARKER[] = "[...]";
+const std::size_t TRUNCATION_MARKER_LENGTH = sizeof(TRUNCATION_MARKER) - 1;
+}
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs a log queue
+ *
+ * @param capacity the number of lines the queue can hold, rounded up to a power of two
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LogQueue::LogQueue(std::size_t capacity) :
+        m_mask{[capacity]() {
+            std::size_t size = 2;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            return size - 1;
+        }()},
+        m_cells{new Cell[m_mask + 1]}, m_pushPosition{0}, m_padding{}, m_popPosition{0}
+{
+    for (std::size_t i = 0; i <= m_mask; i++) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::size_t LogQueue::getCapacity() const { return m_mask + 1; }
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Pushes a log line, from any thread
+ * @details A free cell is claimed by moving the push position forward,
+ * then published by setting its sequence to the position that pops it.
+ * A line longer than LogRecord::TEXT_CAPACITY is truncated, ending with "[...]"
+ *
+ * @param level the line category
+ * @param text the line text
+ * @param length the line length
+ * @return false if the queue is full
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LogQueue::tryPush(LogLevel level, const char* text, std::size_t length)
+{
+    std::size_t position = m_pushPosition.load(std::memory_order_relaxed);
+    Cell* cell;
+
+    for (;;) {
+        cell = &m_cells[position & m_mask];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+        if (difference == 0) {
+            if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = m_pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->record.level = static_cast<std::uint8_t>(level);
+    if (length <= LogRecord::TEXT_CAPACITY) {
+        cell->record.length = static_cast<std::uint16_t>(length);
+        std::memcpy(cell->record.text, text, length);
+    } else {
+        const std::size_t keptLength = LogRecord::TEXT_CAPACITY - TRUNCATION_MARKER_LENGTH;
+        cell->record.length = static_cast<std::uint16_t>(LogRecord::TEXT_CAPACITY);
+        std::memcpy(cell->record.text, text, keptLength);
+        std::memcpy(cell->record.text + keptLength, TRUNCATION_MARKER, TRUNCATION_MARKER_LENGTH);
+    }
+    cell->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Pops the oldest log line, from the consumer thread only
+ *
+ * @param record the record receiving the line
+ * @return false if the queue is empty
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LogQueue::tryPop(LogRecord& record)
+{
+    Cell& cell = m_cells[m_popPosition & m_mask];
+    if (cell.sequence.load(std::memory_order_acquire) != m_popPosition + 1) {
+        return false;
+    }
+
+    record.level = cell.record.level;
+    record.length = cell.record.length;
+    std::memcpy(record.text, cell.record.text, record.length);
+    cell.sequence.store(m_popPosition + m_mask + 1, std::memory_order_release);
+    m_popPosition++;
+
+    return true;
+}
+
+} //namespace SimpleLogger
+} //namespace Bokoblin
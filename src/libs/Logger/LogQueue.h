@@ -0,0 +1,104 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef LOG_QUEUE_H
+#define LOG_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Bokoblin
+{
+namespace SimpleLogger
+{
+
+/**
+ * The LogLevel enum defines the categories of log lines
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum LogLevel
+{
+    LOG_DEBUG,
+    LOG_INFO,
+    LOG_WARNING,
+    LOG_ERROR
+};
+
+/**
+ * The LogRecord struct holds one queued log line.
+ * Its text is stored inline, so queuing a line never allocates.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct LogRecord
+{
+    static constexpr std::size_t TEXT_CAPACITY = 246;
+
+    std::uint8_t level;
+    std::uint16_t length;
+    char text[TEXT_CAPACITY];
+};
+
+/**
+ * The LogQueue class is a bounded lock-free ring buffer
+ * where several threads push log lines and a single one pops them.
+ * Each cell holds a sequence number telling whether it is free
+ * for the push matching its position or ready to be popped.
+ *
+ * Lines longer than LogRecord::TEXT_CAPACITY are truncated
+ * and marked as such: LogWriter writes them without queuing them.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class LogQueue
+{
+public:
+    //=== CTORs / DTORs
+    explicit LogQueue(std::size_t capacity);
+    LogQueue(const LogQueue&) = delete;
+    LogQueue& operator=(const LogQueue&) = delete;
+
+    //=== GETTERS
+    std::size_t getCapacity() const;
+
+    //=== METHODS
+    bool tryPush(LogLevel level, const char* text, std::size_t length);
+    bool tryPop(LogRecord& record);
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        LogRecord record;
+    };
+
+    //=== ATTRIBUTES
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    std::atomic<std::size_t> m_pushPosition;
+    //Keeps the pop position on another cache line than the push one
+    char m_padding[64 - sizeof(std::atomic<std::size_t>)];
+    std::size_t m_popPosition;
+};
+
+} //namespace SimpleLogger
+} //namespace Bokoblin
+
+
+#endif
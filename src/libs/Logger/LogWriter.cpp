@@ -0,0 +1,348 @@
+#include "LogWriter.h"
+
+namespace Bokoblin
+{
+namespace SimpleLogger
+{
+
+namespace
+{
+const char* const LEVEL_PREFIXES[] = {"[DEBUG] ", "[INFO] ", "[WARNING] ", "[ERROR] "};
+}
+
+constexpr std::size_t LogWriter::QUEUE_CAPACITY;
+constexpr std::size_t LogWriter::BATCH_SIZE;
+constexpr std::chrono::milliseconds LogWriter::WRITE_INTERVAL;
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs a log writer and starts its thread
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LogWriter::LogWriter() :
+        m_queue(QUEUE_CAPACITY), m_pushedCount{0}, m_writtenCount{0}, m_droppedCount{0},
+        m_overflowPolicy{LOG_BLOCK}, m_isRunning{true}, m_wakeRequested{false}, m_file{nullptr},
+        m_thread(&LogWriter::run, this)
+{}
+
+
+//------------------------------------------------
+//          DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * Destructor, writing remaining lines
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LogWriter::~LogWriter()
+{
+    stop();
+    if (m_file != nullptr) {
+        std::fclose(m_file);
+    }
+}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+std::uint64_t LogWriter::getDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+
+
+//------------------------------------------------
+//          SETTERS
+//------------------------------------------------
+
+void LogWriter::setOverflowPolicy(LogOverflowPolicy policy)
+{
+    m_overflowPolicy.store(policy, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes next lines at the end of a file instead of the console
+ * @details Already queued lines are written to the previous output first
+ *
+ * @param filename the file name
+ * @return true if the file could be opened
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool LogWriter::setFile(const std::string& filename)
+{
+    std::FILE* file = std::fopen(filename.c_str(), "a");
+    if (file == nullptr) {
+        return false;
+    }
+
+    flush();
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    if (m_file != nullptr) {
+        std::fclose(m_file);
+    }
+    m_file = file;
+
+    return true;
+}
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Queues a log line, from any thread
+ * @details When the queue is full, the line is either dropped
+ * or the thread waits for the writer, following the overflow policy.
+ * Lines too long for the queue are written directly once previous lines are written,
+ * as well as lines queued after the writer thread's last pass
+ *
+ * @param level the line category
+ * @param message the line text
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::write(LogLevel level, const std::string& message)
+{
+    if (message.size() > LogRecord::TEXT_CAPACITY) {
+        flush();
+        std::string output, errors;
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        appendLine(output, errors, level, message.data(), message.size());
+        writeOutput(output, errors);
+        return;
+    }
+
+    bool isQueued = m_isRunning.load(std::memory_order_acquire);
+
+    while (isQueued && !m_queue.tryPush(level, message.data(), message.size())) {
+        if (m_overflowPolicy.load(std::memory_order_relaxed) == LOG_DROP) {
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        wake();
+        std::this_thread::yield();
+        isQueued = m_isRunning.load(std::memory_order_acquire);
+    }
+
+    if (!isQueued) {
+        std::string output, errors;
+        std::lock_guard<std::mutex> lock(m_fileMutex);
+        appendLine(output, errors, level, message.data(), message.size());
+        writeOutput(output, errors);
+        return;
+    }
+
+    const std::uint64_t pushedCount = m_pushedCount.fetch_add(1, std::memory_order_release) + 1;
+
+    //Either this thread sees the writer stopped, or the stopping thread sees the line
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!m_isRunning.load(std::memory_order_relaxed)) {
+        writeQueuedLines();
+    } else if (pushedCount - m_writtenCount.load(std::memory_order_relaxed) >= QUEUE_CAPACITY / 2) {
+        wake();
+    }
+}
+
+/**
+ * @brief Waits until lines queued before the call are written
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::flush()
+{
+    if (m_isRunning.load(std::memory_order_acquire)) {
+        const std::uint64_t target = m_pushedCount.load(std::memory_order_acquire);
+        wake();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_flushCondition.wait(lock, [this, target]() {
+            return m_writtenCount.load(std::memory_order_acquire) >= target
+                    || !m_isRunning.load(std::memory_order_acquire);
+        });
+    }
+}
+
+/**
+ * @brief Stops the writer thread once all queued lines are written
+ * @details Lines queued by other threads while stopping are written by the caller.
+ * Next lines are written directly by their logging thread.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::stop()
+{
+    if (!m_isRunning.exchange(false)) {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    wake();
+    m_thread.join();
+    writeQueuedLines();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_flushCondition.notify_all();
+}
+
+/**
+ * @brief Writer thread loop
+ * @details Queued lines are written by batches,
+ * the thread sleeping until woken up or the write interval elapsed
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::run()
+{
+    std::string output, errors;
+    std::uint64_t reportedDropCount = 0;
+
+    for (;;) {
+        const bool isRunning = m_isRunning.load(std::memory_order_acquire);
+        std::size_t writtenCount;
+
+        {
+            std::lock_guard<std::mutex> lock(m_fileMutex);
+            output.clear();
+            errors.clear();
+            writtenCount = drainQueue(output, errors);
+
+            const std::uint64_t dropCount = m_droppedCount.load(std::memory_order_relaxed);
+            if (dropCount != reportedDropCount) {
+                const std::string warning = std::to_string(dropCount - reportedDropCount)
+                        + " log lines dropped, the log queue was full";
+                appendLine(output, errors, LOG_WARNING, warning.data(), warning.size());
+                reportedDropCount = dropCount;
+            }
+
+            writeOutput(output, errors);
+        }
+
+        if (writtenCount > 0) {
+            m_writtenCount.fetch_add(writtenCount, std::memory_order_release);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_flushCondition.notify_all();
+        } else if (!isRunning) {
+            break;
+        } else {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait_for(lock, WRITE_INTERVAL, [this]() { return m_wakeRequested; });
+            m_wakeRequested = false;
+        }
+    }
+}
+
+/**
+ * @brief Wakes the writer thread up
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::wake()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_wakeRequested = true;
+    m_wakeCondition.notify_one();
+}
+
+/**
+ * @brief Writes all queued lines from the calling thread, once the writer is stopped
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::writeQueuedLines()
+{
+    std::string output, errors;
+    std::size_t writtenCount = 0;
+    std::size_t batchCount;
+
+    std::lock_guard<std::mutex> lock(m_fileMutex);
+    do {
+        batchCount = drainQueue(output, errors);
+        writtenCount += batchCount;
+    } while (batchCount > 0);
+
+    writeOutput(output, errors);
+    m_writtenCount.fetch_add(writtenCount, std::memory_order_release);
+}
+
+/**
+ * @brief Pops at most a batch of queued lines
+ * @details The file mutex must be locked by the caller
+ *
+ * @param output the buffer receiving lines
+ * @param errors the buffer receiving error lines written to stderr
+ * @return the number of popped lines
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::size_t LogWriter::drainQueue(std::string& output, std::string& errors)
+{
+    LogRecord record{};
+    std::size_t count = 0;
+
+    while (count < BATCH_SIZE && m_queue.tryPop(record)) {
+        appendLine(output, errors, static_cast<LogLevel>(record.level), record.text, record.length);
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Formats a line in the buffer of its output
+ * @details Errors have their own buffer for stderr, unless lines are written to a file.
+ * The file mutex must be locked by the caller.
+ *
+ * @param output the buffer receiving lines
+ * @param errors the buffer receiving error lines written to stderr
+ * @param level the line category
+ * @param text the line text
+ * @param length the line length
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::appendLine(std::string& output, std::string& errors, LogLevel level,
+                           const char* text, std::size_t length) const
+{
+    std::string& buffer = level == LOG_ERROR && m_file == nullptr ? errors : output;
+    buffer.append(LEVEL_PREFIXES[level]);
+    buffer.append(text, length);
+    buffer.push_back('\n');
+}
+
+/**
+ * @brief Writes formatted lines, each buffer at once
+ * @details The file mutex must be locked by the caller
+ *
+ * @param output the lines to write to the file or stdout
+ * @param errors the lines to write to stderr
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void LogWriter::writeOutput(const std::string& output, const std::string& errors)
+{
+    if (!output.empty()) {
+        std::FILE* stream = m_file != nullptr ? m_file : stdout;
+        std::fwrite(output.data(), 1, output.size(), stream);
+        std::fflush(stream);
+    }
+    if (!errors.empty()) {
+        std::fwrite(errors.data(), 1, errors.size(), stderr);
+    }
+}
+
+} //namespace SimpleLogger
+} //namespace Bokoblin
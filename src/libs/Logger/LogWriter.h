@@ -0,0 +1,112 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef LOG_WRITER_H
+#define LOG_WRITER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "LogQueue.h"
+
+namespace Bokoblin
+{
+namespace SimpleLogger
+{
+
+/**
+ * The LogOverflowPolicy enum defines what a thread
+ * does when logging a line while the queue is full
+ * @author Arthur
+ * @date 17/10/2026
+ */
+enum LogOverflowPolicy
+{
+    LOG_DROP,
+    LOG_BLOCK
+};
+
+/**
+ * The LogWriter class writes log lines from a background thread.
+ * Logging threads only copy their line into a LogQueue, the writer
+ * thread pops lines by batches and writes each batch at once,
+ * either to a single open file or to stdout and stderr.
+ *
+ * Once stopped, remaining lines are written and next ones
+ * are written directly by the logging thread. Lines too long
+ * for a LogRecord are written directly too, so that they are never truncated.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class LogWriter
+{
+public:
+    //=== CTORs / DTORs
+    LogWriter();
+    ~LogWriter();
+    LogWriter(const LogWriter&) = delete;
+    LogWriter& operator=(const LogWriter&) = delete;
+
+    //=== GETTERS
+    std::uint64_t getDroppedCount() const;
+
+    //=== SETTERS
+    void setOverflowPolicy(LogOverflowPolicy policy);
+    bool setFile(const std::string& filename);
+
+    //=== METHODS
+    void write(LogLevel level, const std::string& message);
+    void flush();
+    void stop();
+
+private:
+    //=== ATTRIBUTES
+    static constexpr std::size_t QUEUE_CAPACITY = 1024;
+    static constexpr std::size_t BATCH_SIZE = 256;
+    static constexpr std::chrono::milliseconds WRITE_INTERVAL{20};
+
+    LogQueue m_queue;
+    std::atomic<std::uint64_t> m_pushedCount;
+    std::atomic<std::uint64_t> m_writtenCount;
+    std::atomic<std::uint64_t> m_droppedCount;
+    std::atomic<int> m_overflowPolicy;
+    std::atomic<bool> m_isRunning;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_flushCondition;
+    bool m_wakeRequested;
+    std::mutex m_fileMutex;
+    std::FILE* m_file;
+    std::thread m_thread;
+
+    //=== METHODS
+    void run();
+    void wake();
+    void writeQueuedLines();
+    std::size_t drainQueue(std::string& output, std::string& errors);
+    void appendLine(std::string& output, std::string& errors, LogLevel level,
+                    const char* text, std::size_t length) const;
+    void writeOutput(const std::string& output, const std::string& errors);
+};
+
+} //namespace SimpleLogger
+} //namespace Bokoblin
+
+
+#endif
@@ -1,65 +1,59 @@
 #include "Logger.h"
 
+#include <cstdlib>
+#include <ctime>
+
 namespace Bokoblin
 {
 namespace SimpleLogger
 {
 
+constexpr int Logger::COMPILED_MIN_LEVEL;
 std::string Logger::loggerFilename;
+std::atomic<int> Logger::minimumLevel{LOG_INFO};
 
 //------------------------------------------------
 //          PUBLIC METHODS
 //------------------------------------------------
 
 /**
- * @brief Prints an info log line
+ * @brief Checks if lines of a level are printed
  *
- * @param message the message to print along info tag
+ * @param level the level
+ * @return true if the level is compiled in and not below the runtime level
  *
  * @author Arthur
- * @date 12/10/2018
+ * @date 17/10/2026
  */
-void Logger::printInfo(const std::string& message)
+bool Logger::isEnabled(LogLevel level)
 {
-#ifdef ENABLE_FILE_LOGGING
-    printToFile(loggerFilename.empty() ? DEFAULT_LOGGER_FILE : loggerFilename, INFO_PREFIX, message);
-#else
-    printToConsole(INFO_PREFIX, message);
-#endif
+    return isCompiled(level) && level >= minimumLevel.load(std::memory_order_relaxed);
 }
 
 /**
- * @brief Prints a warning log line
- *
- * @param message the message to print along warning tag
+ * @brief Get the lowest printed level at runtime
+ * @return the runtime level
  *
  * @author Arthur
- * @date 12/10/2018
+ * @date 17/10/2026
  */
-void Logger::printWarning(const std::string& message)
+LogLevel Logger::getLevel()
 {
-#ifdef ENABLE_FILE_LOGGING
-    printToFile(loggerFilename.empty() ? DEFAULT_LOGGER_FILE : loggerFilename, WARN_PREFIX, message);
-#else
-    printToConsole(WARN_PREFIX, message);
-#endif
+    return static_cast<LogLevel>(minimumLevel.load(std::memory_order_relaxed));
 }
 
 /**
- * @brief Prints an error log line
+ * @brief Set the lowest printed level at runtime, info by default
+ * @details Levels below LOGGER_MIN_LEVEL stay discarded
  *
- * @param message the message to print along error tag
+ * @param level the runtime level
  *
  * @author Arthur
- * @date 12/10/2018
+ * @date 17/10/2026
  */
-void Logger::printError(const std::string& message)
+void Logger::setLevel(LogLevel level)
 {
-#ifdef ENABLE_FILE_LOGGING
-    printToFile(loggerFilename.empty() ? DEFAULT_LOGGER_FILE : loggerFilename, ERROR_PREFIX, message);
-#else
-    printToConsole(ERROR_PREFIX, message);
-#endif
+    minimumLevel.store(level, std::memory_order_relaxed);
 }
 
 /**
@@ -70,7 +64,7 @@ void Logger::printError(const std::string& message)
  * @param filename the log file name
  *
  * @author Arthur
- * @date 12/10/18 - 13/01/19
+ * @date 12/10/18 - 17/10/2026
  */
 void Logger::setLoggerFile(const std::string& filename)
 {
@@ -78,58 +72,122 @@ void Logger::setLoggerFile(const std::string& filename)
     f.open(filename.c_str(), std::ios::out);
 
     if (f.fail()) {
-        printToConsole(ERROR_PREFIX, "Couldn't set the log file, keeping: "
-        + (loggerFilename.empty() ? DEFAULT_LOGGER_FILE : loggerFilename));
+        printError("Couldn't set the log file, keeping: ",
+                   loggerFilename.empty() ? DEFAULT_LOGGER_FILE : loggerFilename);
     } else {
-        loggerFilename = filename;
         std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
         f << std::ctime(&t) << std::endl;
+        f.close();
+#ifdef ENABLE_FILE_LOGGING
+        if (!getWriter().setFile(filename)) {
+            printError("Couldn't set the log file, keeping: ",
+                       loggerFilename.empty() ? DEFAULT_LOGGER_FILE : loggerFilename);
+            return;
+        }
+#endif
+        loggerFilename = filename;
     }
 }
 
+/**
+ * @brief Set what logging threads do when the log queue is full
+ * @details Blocking is the default, dropping lines keeps logging
+ * threads from waiting for the writer (e.g. in a frame loop)
+ *
+ * @param policy the overflow policy
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Logger::setOverflowPolicy(LogOverflowPolicy policy)
+{
+    getWriter().setOverflowPolicy(policy);
+}
+
+/**
+ * @brief Get the number of lines dropped since the start
+ * @return the dropped lines count
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::uint64_t Logger::getDroppedCount()
+{
+    return getWriter().getDroppedCount();
+}
+
+/**
+ * @brief Waits until all printed lines are written
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Logger::flush()
+{
+    getWriter().flush();
+}
+
+/**
+ * @brief Writes all printed lines and stops the writer thread
+ * @details It's called on exit, next lines being written synchronously
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Logger::shutdown()
+{
+    getWriter().stop();
+}
+
 
 //------------------------------------------------
 //          PRIVATE METHODS
 //------------------------------------------------
 
 /**
- * @brief Prints a log line to the console
+ * @brief Queues a formatted line to the writer
  *
- * @param message the message to print along info tag
- * @param prefix the line prefix to indicate log category
+ * @param level the line level
+ * @param message the line
  *
  * @author Arthur
- * @date 01/01/2018 - 12/10/2018
+ * @date 17/10/2026
  */
-void Logger::printToConsole(const std::string& prefix, const std::string& message)
+void Logger::write(LogLevel level, const std::string& message)
 {
-    if (prefix == ERROR_PREFIX) {
-        std::cerr << prefix << message << std::endl;
-    } else {
-        std::cout << prefix << message << std::endl;
-    }
+    getWriter().write(level, message);
 }
 
 /**
- * @brief Prints a log line to a file
+ * @brief Get the writer, created on first use
+ * @details The writer is never destroyed, so that objects
+ * destroyed after the exit handler can still log
  *
- * @param filename the file name
- * @param message the message to print
- * @param prefix the line prefix to indicate log category
+ * @return the writer
  *
  * @author Arthur
- * @date 12/10/2018
+ * @date 17/10/2026
  */
-void Logger::printToFile(const std::string& filename, const std::string& prefix, const std::string& message)
+LogWriter& Logger::getWriter()
 {
-    std::fstream f;
-    f.open(filename.c_str(), std::ios::app);
+    static LogWriter* writer = createWriter();
+    return *writer;
+}
 
-    if (f.fail()) {
-        printToConsole(ERROR_PREFIX, "Couldn't write to log file");
-    } else {
-        f << prefix << message << std::endl;
-    }
+/**
+ * @brief Creates the writer and registers its shutdown on exit
+ * @return the new writer
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+LogWriter* Logger::createWriter()
+{
+    auto writer = new LogWriter();
+#ifdef ENABLE_FILE_LOGGING
+    writer->setFile(DEFAULT_LOGGER_FILE);
+#endif
+    std::atexit(shutdown);
+    return writer;
 }
 
 } //namespace SimpleLogger
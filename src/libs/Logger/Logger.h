@@ -16,9 +16,18 @@ limitations under the License.
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <type_traits>
+#include "LogWriter.h"
+
+//Lowest level compiled in, lines of lower levels compile to nothing: 0 debug, 1 info, 2 warning, 3 error
+#ifndef LOGGER_MIN_LEVEL
+#define LOGGER_MIN_LEVEL 0
+#endif
 
 namespace Bokoblin
 {
@@ -37,25 +46,90 @@ namespace SimpleLogger
  * It is also possible to change the log file name and path by calling the following function:
  * Logger::setLoggerFile().
  *
+ * Print functions only queue lines, that are written by a background LogWriter.
+ * Lines are flushed on exit or by calling Logger::flush().
+ *
+ * Print functions take the parts of a line (strings, characters and numbers),
+ * only concatenated when its level is enabled. Levels below LOGGER_MIN_LEVEL are
+ * discarded at compile time, and levels below Logger::setLevel() at runtime.
+ *
  * @author Arthur
- * @date 28/12/17 - 12/10/18
+ * @date 28/12/17 - 17/10/2026
  */
 class Logger
 {
 public:
-    static void printInfo(const std::string& message);
-    static void printWarning(const std::string& message);
-    static void printError(const std::string& message);
+    //=== ATTRIBUTES
+    static constexpr int COMPILED_MIN_LEVEL = LOGGER_MIN_LEVEL;
+
+    //=== METHODS
+    template<typename... Parts>
+    static void printDebug(const Parts& ... parts) { print<LOG_DEBUG>(parts...); }
+
+    template<typename... Parts>
+    static void printInfo(const Parts& ... parts) { print<LOG_INFO>(parts...); }
+
+    template<typename... Parts>
+    static void printWarning(const Parts& ... parts) { print<LOG_WARNING>(parts...); }
+
+    template<typename... Parts>
+    static void printError(const Parts& ... parts) { print<LOG_ERROR>(parts...); }
+
+    static constexpr bool isCompiled(LogLevel level) { return level >= COMPILED_MIN_LEVEL; }
+    static bool isEnabled(LogLevel level);
+    static LogLevel getLevel();
+    static void setLevel(LogLevel level);
     static void setLoggerFile(const std::string& filename);
+    static void setOverflowPolicy(LogOverflowPolicy policy);
+    static std::uint64_t getDroppedCount();
+    static void flush();
+    static void shutdown();
 
 private:
-    static void printToConsole(const std::string& prefix, const std::string& message);
-    static void printToFile(const std::string& filename, const std::string& prefix, const std::string& message);
+    /**
+     * @brief Prints a line if its level is enabled
+     * @details Parts are only concatenated when the line is printed,
+     * the check being removed at compile time for levels not compiled in
+     *
+     * @tparam Level the line level
+     * @param parts the parts of the line
+     *
+     * @author Arthur
+     * @date 17/10/2026
+     */
+    template<LogLevel Level, typename... Parts>
+    static void print(const Parts& ... parts)
+    {
+        if (isCompiled(Level) && Level >= minimumLevel.load(std::memory_order_relaxed)) {
+            std::string message;
+            appendParts(message, parts...);
+            write(Level, message);
+        }
+    }
+
+    static void appendParts(std::string&) {}
+
+    template<typename Part, typename... Parts>
+    static void appendParts(std::string& message, const Part& part, const Parts& ... parts)
+    {
+        appendPart(message, part);
+        appendParts(message, parts...);
+    }
+
+    static void appendPart(std::string& message, const std::string& part) { message.append(part); }
+    static void appendPart(std::string& message, const char* part) { message.append(part); }
+    static void appendPart(std::string& message, char part) { message.push_back(part); }
+
+    template<typename Number>
+    static typename std::enable_if<std::is_arithmetic<Number>::value>::type
+    appendPart(std::string& message, Number part) { message.append(std::to_string(part)); }
+
+    static void write(LogLevel level, const std::string& message);
+    static LogWriter& getWriter();
+    static LogWriter* createWriter();
 
     static std::string loggerFilename;
-    static constexpr const char* INFO_PREFIX = "[INFO] ";
-    static constexpr const char* WARN_PREFIX = "[WARNING] ";
-    static constexpr const char* ERROR_PREFIX = "[ERROR] ";
+    static std::atomic<int> minimumLevel;
     static constexpr const char* DEFAULT_LOGGER_FILE = "./app.log";
 };
 
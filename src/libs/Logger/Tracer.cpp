@@ -0,0 +1,307 @@
+#include "Tracer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <vector>
+#include "Logger.h"
+
+namespace Bokoblin
+{
+namespace SimpleLogger
+{
+
+constexpr std::size_t Tracer::MAX_THREAD_EVENT_COUNT;
+
+namespace
+{
+const std::size_t INITIAL_THREAD_EVENT_COUNT = 4096;
+
+/**
+ * Events of one thread, only locked by its thread
+ * except when the whole trace is read
+ */
+struct ThreadBuffer
+{
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    std::size_t droppedCount = 0;
+    std::size_t threadId = 0;
+    std::string threadName;
+};
+
+/**
+ * Buffers of all threads, never destroyed so that
+ * the trace can still be written on exit
+ */
+struct TraceRegistry
+{
+    std::mutex mutex;
+    std::vector<ThreadBuffer*> buffers;
+    std::string outputFile;
+    bool isDumpRegistered = false;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+};
+
+thread_local ThreadBuffer* threadBuffer = nullptr;
+
+TraceRegistry& getRegistry()
+{
+    static TraceRegistry* registry = new TraceRegistry();
+    return *registry;
+}
+
+ThreadBuffer& getThreadBuffer()
+{
+    if (threadBuffer == nullptr) {
+        auto buffer = new ThreadBuffer();
+        buffer->events.reserve(INITIAL_THREAD_EVENT_COUNT);
+
+        TraceRegistry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.buffers.push_back(buffer);
+        buffer->threadId = registry.buffers.size();
+        buffer->threadName = "thread " + std::to_string(buffer->threadId);
+        threadBuffer = buffer;
+    }
+    return *threadBuffer;
+}
+
+void appendJsonString(std::string& output, const char* text)
+{
+    output.push_back('"');
+    for (const char* character = text; *character != '\0'; character++) {
+        if (*character == '"' || *character == '\\') {
+            output.push_back('\\');
+            output.push_back(*character);
+        } else if (static_cast<unsigned char>(*character) >= ' ') {
+            output.push_back(*character);
+        }
+    }
+    output.push_back('"');
+}
+
+void appendMicroseconds(std::string& output, std::int64_t nanoseconds)
+{
+    char number[32];
+    std::snprintf(number, sizeof(number), "%.3f", static_cast<double>(nanoseconds) / 1000);
+    output.append(number);
+}
+}
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+/**
+ * @brief Get the number of recorded events of all threads
+ * @return the event count
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::size_t Tracer::getEventCount()
+{
+    TraceRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::size_t eventCount = 0;
+
+    for (ThreadBuffer* buffer : registry.buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        eventCount += buffer->events.size();
+    }
+    return eventCount;
+}
+
+/**
+ * @brief Get the number of events dropped by full thread buffers
+ * @return the dropped event count
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::size_t Tracer::getDroppedCount()
+{
+    TraceRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::size_t droppedCount = 0;
+
+    for (ThreadBuffer* buffer : registry.buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        droppedCount += buffer->droppedCount;
+    }
+    return droppedCount;
+}
+
+
+//------------------------------------------------
+//          SETTERS
+//------------------------------------------------
+
+/**
+ * @brief Set the name of the calling thread in the trace
+ * @param name the thread name
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Tracer::setThreadName(const std::string& name)
+{
+    ThreadBuffer& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+/**
+ * @brief Set the file the trace is written to on exit
+ * @param filename the trace file name
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Tracer::setOutputFile(const std::string& filename)
+{
+    TraceRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.outputFile = filename;
+
+    if (!registry.isDumpRegistered) {
+        registry.isDumpRegistered = true;
+        std::atexit(dumpOnExit);
+    }
+}
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Get the current time
+ * @return the nanoseconds elapsed since the tracer start
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::int64_t Tracer::now()
+{
+    const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - getRegistry().start;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+/**
+ * @brief Records an event in the calling thread's buffer
+ *
+ * @param category the event category, a string literal
+ * @param name the event name, a string literal
+ * @param begin the begin time, from now()
+ * @param end the end time, from now()
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Tracer::record(const char* category, const char* name, std::int64_t begin, std::int64_t end)
+{
+    ThreadBuffer& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    if (buffer.events.size() < MAX_THREAD_EVENT_COUNT) {
+        buffer.events.push_back({category, name, begin, end});
+    } else {
+        buffer.droppedCount++;
+    }
+}
+
+/**
+ * @brief Writes the events of all threads to a Chrome trace file
+ * @details Each event is written as a complete event (its begin and duration),
+ * preceded by the names of the threads
+ *
+ * @param filename the trace file name
+ * @return true if the file was written
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool Tracer::dump(const std::string& filename)
+{
+    TraceRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::string output = "{\"traceEvents\":[";
+    bool isFirstEvent = true;
+
+    for (ThreadBuffer* buffer : registry.buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        const std::string threadId = std::to_string(buffer->threadId);
+
+        output.append(isFirstEvent ? "\n" : ",\n");
+        output.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + threadId + ",\"args\":{\"name\":");
+        appendJsonString(output, buffer->threadName.c_str());
+        output.append("}}");
+        isFirstEvent = false;
+
+        for (const TraceEvent& event : buffer->events) {
+            output.append(",\n{\"name\":");
+            appendJsonString(output, event.name);
+            output.append(",\"cat\":");
+            appendJsonString(output, event.category);
+            output.append(",\"ph\":\"X\",\"pid\":1,\"tid\":" + threadId + ",\"ts\":");
+            appendMicroseconds(output, event.begin);
+            output.append(",\"dur\":");
+            appendMicroseconds(output, event.end - event.begin);
+            output.push_back('}');
+        }
+    }
+    output.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+    file << output;
+    file.close();
+    return !file.fail();
+}
+
+/**
+ * @brief Removes the events of all threads
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Tracer::clear()
+{
+    TraceRegistry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (ThreadBuffer* buffer : registry.buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->events.clear();
+        buffer->droppedCount = 0;
+    }
+}
+
+/**
+ * @brief Writes the trace to the output file, called on exit
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void Tracer::dumpOnExit()
+{
+    std::string filename;
+    {
+        TraceRegistry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        filename = registry.outputFile;
+    }
+
+    const std::size_t eventCount = getEventCount();
+    const std::size_t droppedCount = getDroppedCount();
+
+    if (dump(filename)) {
+        Logger::printInfo("Trace written to \"", filename, "\" (", eventCount, " events, ",
+                          droppedCount, " dropped)");
+    } else {
+        Logger::printError("Trace writing failed for \"", filename, '"');
+    }
+}
+
+} //namespace SimpleLogger
+} //namespace Bokoblin
@@ -0,0 +1,125 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//Scoped timers are only compiled in when ENABLE_TRACING is set, e.g. by the CMake option
+#ifndef ENABLE_TRACING
+#define ENABLE_TRACING 0
+#endif
+
+#define TRACE_CONCAT_IMPL(first, second) first##second
+#define TRACE_CONCAT(first, second) TRACE_CONCAT_IMPL(first, second)
+
+#if ENABLE_TRACING
+#define TRACE_SCOPE(category, name) \
+    const Bokoblin::SimpleLogger::ScopedTrace TRACE_CONCAT(scopedTrace, __LINE__)(category, name)
+#else
+#define TRACE_SCOPE(category, name) static_cast<void>(0)
+#endif
+
+namespace Bokoblin
+{
+namespace SimpleLogger
+{
+
+/**
+ * The TraceEvent struct holds one timed scope,
+ * its times being in nanoseconds since the tracer start.
+ * Its category and name must be string literals.
+ * @author Arthur
+ * @date 17/10/2026
+ */
+struct TraceEvent
+{
+    const char* category;
+    const char* name;
+    std::int64_t begin;
+    std::int64_t end;
+};
+
+/**
+ * The Tracer class records timed scopes of all threads
+ * and writes them as a Chrome trace file, to be opened
+ * in chrome://tracing or Perfetto.
+ *
+ * Each thread records into its own buffer, created on its first event
+ * and kept after the thread ends. Events beyond a buffer capacity are dropped.
+ *
+ * Scopes are timed with the TRACE_SCOPE(category, name) macro,
+ * that compiles to nothing unless ENABLE_TRACING is set.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class Tracer
+{
+public:
+    //=== ATTRIBUTES
+    static constexpr std::size_t MAX_THREAD_EVENT_COUNT = 1 << 18;
+
+    //=== GETTERS
+    static constexpr bool isCompiled() { return ENABLE_TRACING != 0; }
+    static std::size_t getEventCount();
+    static std::size_t getDroppedCount();
+
+    //=== SETTERS
+    static void setThreadName(const std::string& name);
+    static void setOutputFile(const std::string& filename);
+
+    //=== METHODS
+    static std::int64_t now();
+    static void record(const char* category, const char* name, std::int64_t begin, std::int64_t end);
+    static bool dump(const std::string& filename);
+    static void clear();
+
+private:
+    static void dumpOnExit();
+};
+
+/**
+ * The ScopedTrace class records the time between its
+ * construction and its destruction as a trace event
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class ScopedTrace
+{
+public:
+    //=== CTORs / DTORs
+    ScopedTrace(const char* category, const char* name) :
+            m_category{category}, m_name{name}, m_begin{Tracer::now()} {}
+    ~ScopedTrace() { Tracer::record(m_category, m_name, m_begin, Tracer::now()); }
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    //=== ATTRIBUTES
+    const char* m_category;
+    const char* m_name;
+    std::int64_t m_begin;
+};
+
+} //namespace SimpleLogger
+} //namespace Bokoblin
+
+
+#endif
@@ -8,6 +8,8 @@ namespace Bokoblin
 namespace MaterialDesignComponentsForSFML
 {
 
+std::size_t Sprite::loadedTextureBytes = 0;
+
 //------------------------------------------------
 //          CONSTRUCTORS / DESTRUCTOR
 //------------------------------------------------
@@ -20,11 +22,11 @@ namespace MaterialDesignComponentsForSFML
  * @param image the image used for the texture (optional)
  *
  * @author Arthur
- * @date 21/02/16 - 13/09/18
+ * @date 21/02/16 - 17/10/2026
  */
 Sprite::Sprite(float width, float height, const string& image) :
         m_width{width}, m_height{height}, m_isVisible{true},
-        m_alpha{255}, m_light{100}, m_textureFilename{image}, m_initialColor{getColor()}
+        m_alpha{255}, m_light{100}, m_textureFilename{image}, m_initialColor{getColor()}, m_textureBytes{0}
 {
     if (!image.empty()) {
         Sprite::loadAndApplyTextureFromImageFile(image);
@@ -82,17 +84,17 @@ Sprite::Sprite(float size, const std::string &image) :
 
 
 /**
- * Copy Constructor
+ * Copy Constructor, sharing the texture of the other sprite
  *
  * @param other another button object to copy
  *
  * @author Arthur, Florian
- * @date 25/02/16 - 16/09/18
+ * @date 25/02/16 - 17/10/2026
  */
 Sprite::Sprite(Sprite const& other) :
         sf::Sprite(other), m_width(other.m_width), m_height(other.m_height),
         m_isVisible{other.m_isVisible}, m_alpha{other.m_alpha}, m_light{other.m_light},
-        m_textureFilename{other.m_textureFilename}, m_initialColor{other.m_initialColor}
+        m_textureFilename{other.m_textureFilename}, m_initialColor{other.m_initialColor}, m_textureBytes{0}
 {
     this->setPosition(other.getPosition());
     this->setTexture(*other.getTexture(), true);
@@ -103,9 +105,12 @@ Sprite::Sprite(Sprite const& other) :
 /**
  * Destructor
  * @author Arthur, Florian
- * @date 21/02/16
+ * @date 21/02/16 - 17/10/2026
  */
-Sprite::~Sprite() = default;
+Sprite::~Sprite()
+{
+    loadedTextureBytes -= m_textureBytes;
+}
 
 
 //------------------------------------------------
@@ -128,6 +133,16 @@ int Sprite::getLight() const { return m_light; }
 
 string Sprite::getTextureFileName() const { return m_textureFilename; }
 
+/**
+ * Get the memory used by textures loaded by sprites,
+ * counting 4 bytes per pixel
+ * @return the memory in bytes
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::size_t Sprite::getLoadedTextureBytes() { return loadedTextureBytes; }
+
 
 //------------------------------------------------
 //          SETTERS
@@ -302,10 +317,14 @@ void Sprite::loadAndApplyTextureFromImageFile(const string& imageFile, const sf:
  * @param area the image area to use
  *
  * @author Arthur
- * @date 04/01/18
+ * @date 04/01/18 - 17/10/2026
  */
 void Sprite::processTextureLoading(const string& imageFile)
 {
+    loadedTextureBytes -= m_textureBytes;
+    m_textureBytes = static_cast<std::size_t>(m_texture.getSize().x) * m_texture.getSize().y * 4;
+    loadedTextureBytes += m_textureBytes;
+
     m_texture.setSmooth(true);
     setTexture(m_texture);
     m_textureFilename = imageFile;
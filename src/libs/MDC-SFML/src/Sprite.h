@@ -37,9 +37,10 @@ namespace MaterialDesignComponentsForSFML
  * It keeps the texture (and its filename) used to set sprite texture
  * for sync purpose in inherited classes.
  * Finally, it allows resize and position containing check.
+ * The memory of all loaded textures is counted.
  *
  * @author Arthur, Florian
- * @date 21/02/16 - 03/05/2020
+ * @date 21/02/16 - 17/10/2026
  *
  * @see sf::Sprite
  */
@@ -63,6 +64,7 @@ public:
     int getAlpha() const;
     int getLight() const;
     std::string getTextureFileName() const;
+    static std::size_t getLoadedTextureBytes();
 
     //=== SETTERS
     void setVisible(bool visible);
@@ -102,6 +104,8 @@ protected:
 private:
     //=== ATTRIBUTES
     sf::Color m_initialColor;
+    std::size_t m_textureBytes;
+    static std::size_t loadedTextureBytes;
 
     //=== METHODS
     void processTextureLoading(const std::string &imageFile);
@@ -72,6 +72,7 @@ void Text::setDescription(const string& description) { m_description = descripti
 void Text::setPositionSelfCentered(float x, float y) { setPosition(x - getWidth()/2, y - getHeight()/2); }
 void Text::setStringFromInt(int value) { setString(std::to_string(value)); }
 void Text::setUtf8String(const string& content) { setString(sf::String::fromUtf8(content.begin(), content.end())); }
+void Text::setUtf32String(const std::basic_string<sf::Uint32>& content) { setString(sf::String(content)); }
 void Text::setVisible(bool visible) { m_isVisible = visible; }
 
 
@@ -31,7 +31,7 @@ namespace MaterialDesignComponentsForSFML
  * It adds visibility, a text description (i.e. identifier) and a font tied to the text.
  *
  * @author Arthur
- * @date 21/12/16 - 13/01/19
+ * @date 21/12/16 - 17/10/2026
  *
  * @see sf::Text
  */
@@ -54,6 +54,7 @@ public:
     void setPositionSelfCentered(float x, float y);
     void setStringFromInt(int value);
     void setUtf8String(const std::string &content);
+    void setUtf32String(const std::basic_string<sf::Uint32> &content);
     void setVisible(bool visible);
 
     //=== METHODS
@@ -0,0 +1,129 @@
+#include "MappedFile.h"
+
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Bokoblin
+{
+namespace XMLUtils
+{
+
+//------------------------------------------------
+//          CONSTRUCTOR
+//------------------------------------------------
+
+/**
+ * Constructs a closed mapped file
+ * @author Arthur
+ * @date 17/10/2026
+ */
+MappedFile::MappedFile() : m_data{nullptr}, m_size{0}, m_isMapped{false}, m_isWritable{false}
+{}
+
+
+//------------------------------------------------
+//          DESTRUCTOR
+//------------------------------------------------
+
+/**
+ * Destructor, unmapping the file
+ * @author Arthur
+ * @date 17/10/2026
+ */
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+bool MappedFile::isOpen() const { return m_data != nullptr; }
+const char* MappedFile::getData() const { return m_data; }
+char* MappedFile::getWritableData() const { return m_isWritable ? m_data : nullptr; }
+std::size_t MappedFile::getSize() const { return m_size; }
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Maps a whole file in memory, closing the previous one
+ * @details Empty files can't be mapped and are reported as failures.
+ * Writing to a writable content never modifies the file.
+ *
+ * @param filename the file name
+ * @param isWritable true to get a writable content, with getWritableData()
+ * @return true if the file content is available
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool MappedFile::open(const std::string& filename, bool isWritable)
+{
+    close();
+
+#ifndef _WIN32
+    const int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor == -1) {
+        return false;
+    }
+
+    struct stat status{};
+    if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+        const int protection = isWritable ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* data = mmap(nullptr, static_cast<std::size_t>(status.st_size), protection, MAP_PRIVATE, descriptor, 0);
+        if (data != MAP_FAILED) {
+            m_data = static_cast<char*>(data);
+            m_size = static_cast<std::size_t>(status.st_size);
+            m_isMapped = true;
+        }
+    }
+    ::close(descriptor);
+#else
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+    if (file.is_open() && file.tellg() > 0) {
+        m_buffer.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        if (file.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()))) {
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+        } else {
+            m_buffer.clear();
+        }
+    }
+#endif
+
+    m_isWritable = isOpen() && isWritable;
+    return isOpen();
+}
+
+/**
+ * @brief Unmaps the file, its content becoming unavailable
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MappedFile::close()
+{
+#ifndef _WIN32
+    if (m_isMapped) {
+        munmap(m_data, m_size);
+    }
+#endif
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_isMapped = false;
+    m_isWritable = false;
+}
+
+} //namespace XMLUtils
+} //namespace Bokoblin
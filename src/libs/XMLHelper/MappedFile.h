@@ -0,0 +1,72 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Bokoblin
+{
+namespace XMLUtils
+{
+
+/**
+ * The MappedFile class gives read access to a whole file content
+ * by mapping it in memory, without copying it.
+ * It can also be mapped as writable, the written pages being copied
+ * so that the file itself is never modified.
+ * On platforms without mapping support, the content is read into a buffer.
+ *
+ * The content stays valid until the file is closed or the object destroyed.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class MappedFile
+{
+public:
+    //=== CTORs / DTORs
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    //=== GETTERS
+    bool isOpen() const;
+    const char* getData() const;
+    char* getWritableData() const;
+    std::size_t getSize() const;
+
+    //=== METHODS
+    bool open(const std::string& filename, bool isWritable = false);
+    void close();
+
+private:
+    //=== ATTRIBUTES
+    char* m_data;
+    std::size_t m_size;
+    bool m_isMapped;
+    bool m_isWritable;
+    std::vector<char> m_buffer;
+};
+
+} //namespace XMLUtils
+} //namespace Bokoblin
+
+
+#endif
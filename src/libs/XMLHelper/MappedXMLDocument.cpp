@@ -0,0 +1,56 @@
+#include "MappedXMLDocument.h"
+#include "../Logger/Tracer.h"
+
+namespace Bokoblin
+{
+namespace XMLUtils
+{
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+pugi::xml_document& MappedXMLDocument::getDocument() { return m_document; }
+const pugi::xml_document& MappedXMLDocument::getDocument() const { return m_document; }
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Maps an xml file and parses it in place, replacing the previous document
+ *
+ * @param filename the file name
+ * @return true on loading success, the document being empty otherwise
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool MappedXMLDocument::load(const std::string& filename)
+{
+    TRACE_SCOPE("xml", "MappedXMLDocument::load");
+    reset();
+
+    if (!m_file.open(filename, true)
+            || m_document.load_buffer_inplace(m_file.getWritableData(), m_file.getSize()).status != pugi::status_ok) {
+        reset();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Empties the document then unmaps its file
+ * @author Arthur
+ * @date 17/10/2026
+ */
+void MappedXMLDocument::reset()
+{
+    m_document.reset();
+    m_file.close();
+}
+
+} //namespace XMLUtils
+} //namespace Bokoblin
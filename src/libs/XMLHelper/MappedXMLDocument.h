@@ -0,0 +1,64 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MAPPED_XML_DOCUMENT_H
+#define MAPPED_XML_DOCUMENT_H
+
+#include <string>
+#include <pugixml.hpp>
+#include "MappedFile.h"
+
+namespace Bokoblin
+{
+namespace XMLUtils
+{
+
+/**
+ * The MappedXMLDocument class holds an xml document parsed in place
+ * in its memory mapped file, names and values pointing into the mapping
+ * instead of being copied. The mapping is kept alive with the document. \n
+ * The mapping is private: the document can be modified,
+ * but the file must only be replaced as a whole (see XMLHelper::saveXMLFile()),
+ * never rewritten in place while the document is loaded.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class MappedXMLDocument
+{
+public:
+    //=== CTORs / DTORs
+    MappedXMLDocument() = default;
+    MappedXMLDocument(const MappedXMLDocument&) = delete;
+    MappedXMLDocument& operator=(const MappedXMLDocument&) = delete;
+
+    //=== GETTERS
+    pugi::xml_document& getDocument();
+    const pugi::xml_document& getDocument() const;
+
+    //=== METHODS
+    bool load(const std::string& filename);
+    void reset();
+
+private:
+    //=== ATTRIBUTES
+    MappedFile m_file;
+    pugi::xml_document m_document; //Declared after the file it points into, so that it is destroyed first
+};
+
+} //namespace XMLUtils
+} //namespace Bokoblin
+
+#endif
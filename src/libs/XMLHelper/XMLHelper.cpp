@@ -1,5 +1,7 @@
+#include <cstdio>
 #include <unistd.h>
 #include "XMLHelper.h"
+#include "../Logger/Tracer.h"
 
 namespace Bokoblin
 {
@@ -23,10 +25,11 @@ using std::ios;
  * @return a boolean indicating if file was created
  *
  * @author Arthur
- * @date 02/05/16 - 16/07/18
+ * @date 02/05/16 - 17/10/2026
  */
 bool XMLHelper::createXMLFile(const std::string& filename, const std::string& content)
 {
+    TRACE_SCOPE("xml", "XMLHelper::createXMLFile");
     fstream f;
     f.open(filename.c_str(), ios::out);
     if (f.is_open() && !f.fail()) {
@@ -45,10 +48,11 @@ bool XMLHelper::createXMLFile(const std::string& filename, const std::string& co
  * @return a boolean indicating if file was removed
  *
  * @author Arthur
- * @date 16/07/18
+ * @date 16/07/18 - 17/10/2026
  */
 bool XMLHelper::removeXMLFile(const std::string& filename)
 {
+    TRACE_SCOPE("xml", "XMLHelper::removeXMLFile");
     return remove(filename.c_str()) == EXIT_SUCCESS;
 }
 
@@ -60,10 +64,11 @@ bool XMLHelper::removeXMLFile(const std::string& filename)
  * @return a boolean indicating if file has its integrity
  *
  * @author Arthur
- * @date 16/07/18
+ * @date 16/07/18 - 17/10/2026
  */
 bool XMLHelper::checkXMLStreamIntegrity(std::istream& content)
 {
+    TRACE_SCOPE("xml", "XMLHelper::checkXMLStreamIntegrity");
     pugi::xml_document doc;
     return doc.load(content);
 }
@@ -77,10 +82,11 @@ bool XMLHelper::checkXMLStreamIntegrity(std::istream& content)
  * @return a boolean
  *
  * @author Arthur
- * @date 17/07/18
+ * @date 17/07/18 - 17/10/2026
  */
 bool XMLHelper::checkXMLFileExistence(const std::string& filename)
 {
+    TRACE_SCOPE("xml", "XMLHelper::checkXMLFileExistence");
     return filename.substr(filename.rfind('.') + 1) == "xml"
             && access(filename.c_str(), F_OK) != -1;
 }
@@ -95,15 +101,60 @@ bool XMLHelper::checkXMLFileExistence(const std::string& filename)
  * @return true on loading success, false otherwise
  *
  * @author Arthur
- * @date 22/01/18 - 15/07/2018
+ * @date 22/01/18 - 17/10/2026
  */
 bool XMLHelper::loadXMLFile(pugi::xml_document& xmlDocumentObject, const std::string& filename)
 {
+    TRACE_SCOPE("xml", "XMLHelper::loadXMLFile");
     pugi::xml_parse_result loadingResult = xmlDocumentObject.load_file(filename.c_str());
     return loadingResult.status == pugi::status_ok;
 }
 
 
+/**
+ * @brief Loads an XML file without copying it
+ * @details The file is mapped in memory and parsed in place,
+ * the document keeping the mapping until it's reset or loaded again
+ *
+ * @param xmlDocumentObject the document to load
+ * @param filename the file name
+ * @return true on loading success, false otherwise
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool XMLHelper::loadXMLFile(MappedXMLDocument& xmlDocumentObject, const std::string& filename)
+{
+    return xmlDocumentObject.load(filename);
+}
+
+
+/**
+ * @brief Saves an XML document to a file
+ * @details The document is written to a temporary file replacing the file once complete,
+ * so that the file is never left half written, nor rewritten while mapped
+ *
+ * @param xmlDocumentObject the document to save
+ * @param filename the file name
+ * @return true on saving success, false otherwise
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool XMLHelper::saveXMLFile(const pugi::xml_document& xmlDocumentObject, const std::string& filename)
+{
+    TRACE_SCOPE("xml", "XMLHelper::saveXMLFile");
+    const string temporaryFilename = filename + ".tmp";
+
+    if (!xmlDocumentObject.save_file(temporaryFilename.c_str())) {
+        remove(temporaryFilename.c_str());
+        return false;
+    }
+
+    return rename(temporaryFilename.c_str(), filename.c_str()) == 0;
+}
+
+
 /**
  * @brief Retrieves a string matching a given label in a given file
  * @details the string must be contained in a line of this style:
@@ -114,15 +165,16 @@ bool XMLHelper::loadXMLFile(pugi::xml_document& xmlDocumentObject, const std::st
  * @return the string if found or the label between brackets: <> otherwise
  *
  * @author Arthur
- * @date 04/01/17 - 25/01/18
+ * @date 04/01/17 - 17/10/2026
  */
 string XMLHelper::loadLabeledString(const string& filename, const string& label)
 {
+    TRACE_SCOPE("xml", "XMLHelper::loadLabeledString");
     const string default_value = "<" + label + ">";
-    pugi::xml_document doc;
+    MappedXMLDocument doc;
 
     if (XMLHelper::loadXMLFile(doc, filename)) {
-        pugi::xml_node resources = doc.child("resources");
+        pugi::xml_node resources = doc.getDocument().child("resources");
 
         for (pugi::xml_node item: resources.children("string")) {
             if (string(item.attribute("name").value()) == label) {
@@ -145,16 +197,13 @@ string XMLHelper::loadLabeledString(const string& filename, const string& label)
  * @return a boolean
  *
  * @author Arthur
- * @date 26/01/18
+ * @date 26/01/18 - 17/10/2026
  */
 template<>
 bool XMLHelper::safeRetrieveXMLValue<bool>
         (const pugi::xml_attribute& attribute, const std::string& regexString, const bool& defaultValue)
 {
-    const std::string result = std::string(attribute.value());
-    const std::regex regex(regexString);
-
-    if (regexString.empty() || std::regex_match(result.c_str(), regex)) {
+    if (XMLValueValidator::matches(attribute.value(), regexString)) {
         return attribute.as_bool(defaultValue);
     } else {
         return defaultValue;
@@ -172,16 +221,13 @@ bool XMLHelper::safeRetrieveXMLValue<bool>
  * @return a signed 32-bit integer
  *
  * @author Arthur
- * @date 26/01/18
+ * @date 26/01/18 - 17/10/2026
  */
 template<>
 int XMLHelper::safeRetrieveXMLValue<int>
         (const pugi::xml_attribute& attribute, const std::string& regexString, const int& defaultValue)
 {
-    const std::string result = std::string(attribute.value());
-    const std::regex regex(regexString);
-
-    if (regexString.empty() || std::regex_match(result.c_str(), regex)) {
+    if (XMLValueValidator::matches(attribute.value(), regexString)) {
         return attribute.as_int(defaultValue);
     } else {
         return defaultValue;
@@ -199,16 +245,13 @@ int XMLHelper::safeRetrieveXMLValue<int>
  * @return a string
  *
  * @author Arthur
- * @date 26/01/18
+ * @date 26/01/18 - 17/10/2026
  */
 template<>
 string XMLHelper::safeRetrieveXMLValue<string>
         (const pugi::xml_attribute& attribute, const std::string& regexString, const string& defaultValue)
 {
-    const std::string result = std::string(attribute.value());
-    const std::regex regex(regexString);
-
-    if (regexString.empty() || std::regex_match(result.c_str(), regex)) {
+    if (XMLValueValidator::matches(attribute.value(), regexString)) {
         return attribute.as_string(defaultValue.c_str());
     } else {
         return defaultValue;
@@ -226,16 +269,13 @@ string XMLHelper::safeRetrieveXMLValue<string>
  * @return an unsigned 32-bit integer
  *
  * @author Arthur
- * @date 26/01/18
+ * @date 26/01/18 - 17/10/2026
  */
 template<>
 unsigned int XMLHelper::safeRetrieveXMLValue<unsigned int>
         (const pugi::xml_attribute& attribute, const std::string& regexString, const unsigned int& defaultValue)
 {
-    const std::string result = std::string(attribute.value());
-    const std::regex regex(regexString);
-
-    if (regexString.empty() || std::regex_match(result.c_str(), regex)) {
+    if (XMLValueValidator::matches(attribute.value(), regexString)) {
         return attribute.as_uint(defaultValue);
     } else {
         return defaultValue;
@@ -20,8 +20,9 @@ limitations under the License.
 #include <sstream>
 #include <iostream>
 #include <fstream>
-#include <regex>
 #include <pugixml.hpp>
+#include "MappedXMLDocument.h"
+#include "XMLValueValidator.h"
 
 namespace Bokoblin
 {
@@ -38,7 +39,7 @@ using XmlAttribute = pugi::xml_attribute;
  * It abstracts PugiXML usage from other classes visibility
  *
  * @author Arthur
- * @date 22/01/18 - 17/07/18
+ * @date 22/01/18 - 17/10/2026
  */
 class XMLHelper
 {
@@ -49,6 +50,8 @@ public:
     static bool checkXMLFileExistence(const std::string& filename);
     static bool checkXMLStreamIntegrity(std::istream& content);
     static bool loadXMLFile(pugi::xml_document& xmlDocumentObject, const std::string& filename);
+    static bool loadXMLFile(MappedXMLDocument& xmlDocumentObject, const std::string& filename);
+    static bool saveXMLFile(const pugi::xml_document& xmlDocumentObject, const std::string& filename);
     static std::string loadLabeledString(const std::string& filename, const std::string& label);
 
     /**
@@ -61,6 +64,7 @@ public:
      * Passing other types than the above listed may lead into an undefined behaviour. \n
      *
      * You can specify an empty regex, the check won't be taken into account.
+     * Each regex is compiled once, common ones being checked without regex (see XMLValueValidator).
      * You MUST specify a valid default value, otherwise you can encounter
      * an undefined behaviour on retrieval failure.
      *
@@ -70,7 +74,7 @@ public:
      * @return a Type object
      *
      * @author Arthur
-     * @date 25/01/18 - 26/01/18
+     * @date 25/01/18 - 17/10/2026
      */
     template<typename Type>
     static Type safeRetrieveXMLValue(const pugi::xml_attribute& attribute,
@@ -78,11 +82,8 @@ public:
     {
         //NOTE: Implementation must be in-place due to C++ limitation
 
-        const std::string result = std::string(attribute.value());
-        const std::regex regex(regexString);
-
-        if (regexString.empty() || std::regex_match(result.c_str(), regex)) {
-            std::istringstream ss(result);
+        if (XMLValueValidator::matches(attribute.value(), regexString)) {
+            std::istringstream ss(attribute.value());
             Type res;
             ss >> res;
             return res;
@@ -0,0 +1,181 @@
+#include <cstring>
+#include <regex>
+#include <vector>
+#include "XMLValueValidator.h"
+#include "../Logger/Logger.h"
+
+namespace Bokoblin
+{
+namespace XMLUtils
+{
+
+using std::string;
+using Bokoblin::SimpleLogger::Logger;
+
+namespace
+{
+enum ValidatorType
+{
+    UNSIGNED_INTEGER,
+    WORD_SET,
+    REGEX
+};
+}
+
+/**
+ * A compiled pattern
+ */
+struct XMLValueValidator::Validator
+{
+    ValidatorType type;
+    std::vector<string> words;
+    std::regex regex;
+};
+
+//------------------------------------------------
+//          STATIC MEMBERS
+//------------------------------------------------
+
+std::mutex XMLValueValidator::m_validatorsMutex;
+std::unordered_map<string, std::unique_ptr<XMLValueValidator::Validator>> XMLValueValidator::m_validators;
+
+//------------------------------------------------
+//          GETTERS
+//------------------------------------------------
+
+/**
+ * @brief Get the number of patterns compiled so far
+ * @return the cached validator count
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::size_t XMLValueValidator::getCachedValidatorCount()
+{
+    std::lock_guard<std::mutex> lock(m_validatorsMutex);
+    return m_validators.size();
+}
+
+
+//------------------------------------------------
+//          METHODS
+//------------------------------------------------
+
+/**
+ * @brief Checks if a whole value matches a pattern
+ *
+ * @param value the value to check
+ * @param pattern the regex pattern, empty to accept any value
+ * @return true if the value matches
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool XMLValueValidator::matches(const char* value, const string& pattern)
+{
+    if (pattern.empty()) {
+        return true;
+    }
+
+    const Validator& validator = getValidator(pattern);
+
+    switch (validator.type) {
+        case UNSIGNED_INTEGER:
+            return isUnsignedInteger(value);
+        case WORD_SET:
+            for (const string& word : validator.words) {
+                if (strcmp(value, word.c_str()) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        default:
+            return std::regex_match(value, validator.regex);
+    }
+}
+
+/**
+ * @brief Retrieves the validator of a pattern, compiled on first use
+ * @details Validators are shared by all threads and kept until exit
+ *
+ * @param pattern the regex pattern
+ * @return the pattern validator
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+const XMLValueValidator::Validator& XMLValueValidator::getValidator(const string& pattern)
+{
+    std::lock_guard<std::mutex> lock(m_validatorsMutex);
+    std::unique_ptr<Validator>& validator = m_validators[pattern];
+
+    if (validator == nullptr) {
+        validator = compile(pattern);
+    }
+
+    return *validator;
+}
+
+/**
+ * @brief Compiles a pattern into a validator
+ * @details An invalid regex gives a validator rejecting all values
+ *
+ * @param pattern the regex pattern
+ * @return the pattern validator
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+std::unique_ptr<XMLValueValidator::Validator> XMLValueValidator::compile(const string& pattern)
+{
+    std::unique_ptr<Validator> validator(new Validator());
+
+    if (pattern == "^(0|[1-9][0-9]*)$" || pattern == "0|[1-9][0-9]*") {
+        validator->type = UNSIGNED_INTEGER;
+    } else if (pattern.find_first_not_of("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_|") == string::npos
+            && pattern.front() != '|' && pattern.back() != '|' && pattern.find("||") == string::npos) {
+        validator->type = WORD_SET;
+        std::size_t begin = 0;
+        for (std::size_t end = pattern.find('|'); end != string::npos; end = pattern.find('|', begin)) {
+            validator->words.push_back(pattern.substr(begin, end - begin));
+            begin = end + 1;
+        }
+        validator->words.push_back(pattern.substr(begin));
+    } else {
+        try {
+            validator->type = REGEX;
+            validator->regex = std::regex(pattern, std::regex::optimize);
+        } catch (const std::regex_error& e) {
+            Logger::printError("Invalid validation pattern \"", pattern, "\": ", e.what());
+            validator->type = WORD_SET;
+        }
+    }
+
+    return validator;
+}
+
+/**
+ * @brief Checks if a value is an unsigned integer without leading zero
+ *
+ * @param value the value to check
+ * @return true if the value is "0" or a non-zero digit followed by digits
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+bool XMLValueValidator::isUnsignedInteger(const char* value)
+{
+    if (value[0] == '0') {
+        return value[1] == '\0';
+    }
+
+    const char* character = value;
+    while (*character >= '0' && *character <= '9') {
+        character++;
+    }
+
+    return character != value && *character == '\0';
+}
+
+} //namespace XMLUtils
+} //namespace Bokoblin
@@ -0,0 +1,67 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef XML_VALUE_VALIDATOR_H
+#define XML_VALUE_VALIDATOR_H
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace Bokoblin
+{
+namespace XMLUtils
+{
+
+/**
+ * The XMLValueValidator class checks xml values against regex patterns,
+ * each pattern being compiled once into a validator shared by all threads. \n
+ * An empty pattern accepts any value, without validator. \n
+ * Common patterns are recognized and checked without regex:
+ * - "^(0|[1-9][0-9]*)$" or "0|[1-9][0-9]*" accepts unsigned integers
+ * - words separated by '|' (e.g. "true|false", "en|fr|es") accept one of these words \n
+ * Other patterns are checked with a regex compiled once.
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+class XMLValueValidator
+{
+public:
+    //=== GETTERS
+    static std::size_t getCachedValidatorCount();
+
+    //=== METHODS
+    static bool matches(const char* value, const std::string& pattern);
+
+private:
+    //=== TYPEDEFS
+    struct Validator; //Defined with the validation code, so that <regex> isn't included by users
+
+    //=== ATTRIBUTES
+    static std::mutex m_validatorsMutex;
+    static std::unordered_map<std::string, std::unique_ptr<Validator>> m_validators;
+
+    //=== METHODS
+    static const Validator& getValidator(const std::string& pattern);
+    static std::unique_ptr<Validator> compile(const std::string& pattern);
+    static bool isUnsignedInteger(const char* value);
+};
+
+} //namespace XMLUtils
+} //namespace Bokoblin
+
+#endif
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include "localization/LocalizedStringCatalog.h"
+#include "libs/XMLHelper/XMLHelper.h"
+#include "model/utils/StringHash.h"
+
+using Bokoblin::XMLUtils::XMLHelper;
+
+namespace
+{
+
+/**
+ * The test class LocalizedStringCatalogTest
+ * performs tests on the app class LocalizedStringCatalog
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see LocalizedStringCatalog
+ */
+class LocalizedStringCatalogTest: public ::testing::Test
+{
+protected:
+    const std::string STRINGS_FILE = "test_strings.xml";
+    const std::string CATALOG_FILE = "test_strings.bin";
+
+    void TearDown() override
+    {
+        XMLHelper::removeXMLFile(STRINGS_FILE);
+        remove(CATALOG_FILE.c_str());
+    }
+
+    static std::string find(const LocalizedStringCatalog& catalog, const char* label)
+    {
+        LocalizedString result{};
+        return catalog.find(hash(label), result) ? std::string(result.utf8, result.length) : "<none>";
+    }
+};
+
+/**
+ * Tests that all strings of a file are loaded, the first definition of a label being kept
+ */
+TEST_F(LocalizedStringCatalogTest, load)
+{
+    ASSERT_TRUE(XMLHelper::createXMLFile(STRINGS_FILE,
+            "<resources>\n"
+            "    <string name=\"menu_play\" value=\"Jouer\"/>\n"
+            "    <string name=\"menu_quit\" value=\"Quitter\"/>\n"
+            "    <string name=\"menu_play\" value=\"Ignored\"/>\n"
+            "</resources>\n"));
+
+    LocalizedStringCatalog catalog;
+    ASSERT_TRUE(catalog.load(STRINGS_FILE));
+    EXPECT_EQ(STRINGS_FILE, catalog.getFilename());
+    EXPECT_EQ(2u, catalog.getSize());
+
+    EXPECT_EQ("Jouer", find(catalog, "menu_play"));
+    EXPECT_EQ("Quitter", find(catalog, "menu_quit"));
+    EXPECT_EQ("<none>", find(catalog, "menu_settings"));
+
+    EXPECT_FALSE(catalog.load("missing_strings.xml"));
+    EXPECT_EQ(0u, catalog.getSize());
+}
+
+/**
+ * Tests that a compiled catalog is mapped with the same strings, and that invalid ones are rejected
+ */
+TEST_F(LocalizedStringCatalogTest, loadCompiled)
+{
+    const StringCatalogFormat::Entries entries = {{"menu_play", "Jouer"}, {"menu_quit", "Quitter"}, {"empty", ""}};
+    std::string error;
+    std::ofstream file(CATALOG_FILE.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    ASSERT_TRUE(StringCatalogFormat::write(file, entries, error));
+    file.close();
+
+    LocalizedStringCatalog catalog;
+    ASSERT_TRUE(catalog.loadCompiled(CATALOG_FILE));
+    EXPECT_EQ(3u, catalog.getSize());
+    EXPECT_EQ("Jouer", find(catalog, "menu_play"));
+    EXPECT_EQ("Quitter", find(catalog, "menu_quit"));
+    EXPECT_EQ("", find(catalog, "empty"));
+    EXPECT_EQ("<none>", find(catalog, "menu_settings"));
+
+    std::ofstream truncatedFile(CATALOG_FILE.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    truncatedFile << "BKSC";
+    truncatedFile.close();
+    EXPECT_FALSE(catalog.loadCompiled(CATALOG_FILE));
+    EXPECT_EQ(0u, catalog.getSize());
+    EXPECT_FALSE(catalog.loadCompiled("missing_strings.bin"));
+}
+
+/**
+ * Tests UTF-8 decoding, invalid sequences giving replacement characters
+ */
+TEST_F(LocalizedStringCatalogTest, decodeUtf8)
+{
+    const Utf32String expected = {'a', 0xE9, 0x20AC, 0x1F600};
+    EXPECT_EQ(expected, LocalizedStringCatalog::decodeUtf8("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"));
+
+    const Utf32String invalid = {0xFFFD, 'b', 0xFFFD};
+    EXPECT_EQ(invalid, LocalizedStringCatalog::decodeUtf8("\xC3" "b\xE2\x82"));
+}
+
+} // namespace gtest
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "model/utils/CollisionUtils.h"
+
+namespace
+{
+
+/**
+ * The test class CollisionUtilsTest
+ * performs tests on the app class CollisionUtils
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see CollisionUtils
+ */
+class CollisionUtilsTest: public ::testing::Test
+{
+protected:
+    BoundingBoxBatch batch;
+    std::vector<std::uint32_t> hitMask;
+    std::vector<std::uint32_t> scalarHitMask;
+
+    void fillWithRandomBoxes(std::size_t count)
+    {
+        std::default_random_engine generator;
+        std::uniform_real_distribution<float> position(0, 900);
+        std::uniform_real_distribution<float> size(10, 90);
+
+        batch.clear();
+        for (std::size_t i = 0; i < count; i++) {
+            float left = position(generator);
+            float top = position(generator);
+            batch.add(left, top, left + size(generator), top + size(generator));
+        }
+    }
+};
+
+/**
+ * Tests on CollisionUtils::overlap() function
+ */
+TEST_F(CollisionUtilsTest, overlap)
+{
+    ASSERT_TRUE(CollisionUtils::overlap(0, 0, 10, 10, 5, 5, 15, 15));
+    ASSERT_FALSE(CollisionUtils::overlap(0, 0, 10, 10, 11, 0, 21, 10));
+    ASSERT_FALSE(CollisionUtils::overlap(0, 0, 10, 10, 0, 11, 10, 21));
+}
+
+/**
+ * Tests on CollisionUtils::overlap() function with touching edges
+ */
+TEST_F(CollisionUtilsTest, overlapTouchingEdges)
+{
+    ASSERT_TRUE(CollisionUtils::overlap(0, 0, 10, 10, 10, 0, 20, 10));
+    ASSERT_TRUE(CollisionUtils::overlap(0, 0, 10, 10, 0, 10, 10, 20));
+    ASSERT_TRUE(CollisionUtils::overlap(10, 10, 10, 10, 0, 0, 10, 10));
+}
+
+/**
+ * Tests on CollisionUtils::findOverlaps() function with an empty batch
+ */
+TEST_F(CollisionUtilsTest, findOverlapsEmpty)
+{
+    CollisionUtils::findOverlaps(0, 0, 10, 10, batch, hitMask);
+    ASSERT_TRUE(hitMask.empty());
+}
+
+/**
+ * Tests on CollisionUtils::findOverlaps() function
+ */
+TEST_F(CollisionUtilsTest, findOverlaps)
+{
+    batch.add(20, 0, 30, 10);
+    batch.add(10, 0, 20, 10);
+    batch.add(5, 5, 6, 6);
+
+    CollisionUtils::findOverlaps(0, 0, 10, 10, batch, hitMask);
+
+    ASSERT_EQ(hitMask.size(), 1u);
+    ASSERT_FALSE(CollisionUtils::isHit(hitMask, 0));
+    ASSERT_TRUE(CollisionUtils::isHit(hitMask, 1));
+    ASSERT_TRUE(CollisionUtils::isHit(hitMask, 2));
+}
+
+/**
+ * Tests that CollisionUtils::findOverlaps() function
+ * gives the same result as the scalar reference, whatever the batch size
+ */
+TEST_F(CollisionUtilsTest, findOverlapsMatchesScalar)
+{
+    for (std::size_t count = 1; count <= 100; count++) {
+        fillWithRandomBoxes(count);
+
+        CollisionUtils::findOverlaps(300, 300, 600, 600, batch, hitMask);
+        CollisionUtils::findOverlapsScalar(300, 300, 600, 600, batch, scalarHitMask);
+
+        ASSERT_EQ(hitMask, scalarHitMask) << "kernel " << CollisionUtils::getKernelName() << ", size " << count;
+    }
+}
+
+} // namespace gtest
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "model/game-components/ElementSweepIndex.h"
+
+namespace
+{
+
+/**
+ * The test class ElementSweepIndexTest
+ * performs tests on the app class ElementSweepIndex
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see ElementSweepIndex
+ */
+class ElementSweepIndexTest: public ::testing::Test
+{
+protected:
+    MovableElementStore m_store{16};
+    ElementSweepIndex m_index{&m_store};
+
+    ElementHandle addElement(float x, float width)
+    {
+        const ElementHandle handle = m_store.create(x, 100, width, 20, -1, STANDARD_ENEMY);
+        m_index.insert(handle);
+        return handle;
+    }
+
+    void removeElement(const ElementHandle& handle)
+    {
+        m_index.remove(handle);
+        m_store.destroy(handle);
+    }
+
+    std::vector<float> queryPositions(float minX, float maxX) const
+    {
+        std::vector<std::size_t> indexes;
+        std::vector<float> positions;
+
+        m_index.query(minX, maxX, indexes);
+        for (std::size_t index : indexes) {
+            positions.push_back(m_store.getPosX(index));
+        }
+        return positions;
+    }
+};
+
+/**
+ * Tests that elements straddling a bound of the range are found,
+ * elements entirely outside of it being left out
+ */
+TEST_F(ElementSweepIndexTest, queryStraddlingBounds)
+{
+    addElement(0, 10);
+    addElement(20, 10);
+    addElement(40, 10);
+
+    EXPECT_EQ((std::vector<float>{20}), queryPositions(25, 35));
+    EXPECT_EQ((std::vector<float>{0, 20}), queryPositions(5, 20));
+    EXPECT_EQ((std::vector<float>{40}), queryPositions(50, 60));
+    EXPECT_TRUE(queryPositions(61, 70).empty());
+}
+
+/**
+ * Tests that an element wider than all previous ones is found far from its position,
+ * candidates being still sorted
+ */
+TEST_F(ElementSweepIndexTest, queryWiderElement)
+{
+    addElement(200, 10);
+    EXPECT_TRUE(queryPositions(290, 295).empty());
+
+    addElement(100, 200);
+    const std::vector<float> positions = queryPositions(290, 295);
+    EXPECT_NE(positions.end(), std::find(positions.begin(), positions.end(), 100));
+    EXPECT_TRUE(std::is_sorted(positions.begin(), positions.end()));
+}
+
+/**
+ * Tests that elements stay sorted by position after removals moved them in the store
+ */
+TEST_F(ElementSweepIndexTest, orderAfterRemovals)
+{
+    const ElementHandle first = addElement(50, 10);
+    addElement(10, 10);
+    const ElementHandle third = addElement(90, 10);
+    addElement(30, 10);
+    addElement(70, 10);
+    ASSERT_EQ((std::vector<float>{10, 30, 50, 70, 90}), queryPositions(0, 100));
+
+    removeElement(first);
+    removeElement(third);
+    addElement(60, 10);
+
+    EXPECT_EQ(4u, m_index.getSize());
+    EXPECT_EQ((std::vector<float>{10, 30, 60, 70}), queryPositions(0, 100));
+
+    m_index.clear();
+    EXPECT_TRUE(queryPositions(0, 100).empty());
+}
+
+} // namespace gtest
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "model/profiling/FrameProfiler.h"
+
+namespace
+{
+
+/**
+ * The test class FrameProfilerTest
+ * performs tests on the app classes FrameHistogram and FrameProfiler
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see FrameProfiler
+ */
+class FrameProfilerTest: public ::testing::Test
+{
+protected:
+    const std::string csvFilename = "test_frame_timings.csv";
+
+    void TearDown() override
+    {
+        remove(csvFilename.c_str());
+    }
+};
+
+/**
+ * Tests that each duration falls in a bucket whose value is close to it
+ */
+TEST_F(FrameProfilerTest, bucketsBoundError)
+{
+    unsigned int previousBucket = 0;
+
+    for (std::uint32_t duration = 1; duration < 2000000; duration += 1 + duration / 100) {
+        const unsigned int bucket = FrameHistogram::findBucket(duration);
+        EXPECT_GE(bucket, previousBucket);
+        previousBucket = bucket;
+
+        const std::uint32_t value = FrameHistogram::getBucketValue(bucket);
+        EXPECT_LE(value > duration ? value - duration : duration - value, duration / 16 + 1);
+    }
+}
+
+/**
+ * Tests percentiles of recorded durations
+ */
+TEST_F(FrameProfilerTest, percentiles)
+{
+    FrameHistogram histogram;
+    EXPECT_EQ(0u, histogram.getPercentile(50));
+
+    for (std::uint32_t duration = 1; duration <= 1000; duration++) {
+        histogram.record(duration);
+    }
+    histogram.record(40000);
+
+    EXPECT_EQ(1001u, histogram.getCount());
+    EXPECT_EQ(40000u, histogram.getMax());
+    EXPECT_NEAR(500, histogram.getPercentile(50), 500 / 16);
+    EXPECT_NEAR(950, histogram.getPercentile(95), 950 / 16);
+    EXPECT_NEAR(990, histogram.getPercentile(99), 990 / 16);
+    EXPECT_EQ(40000u, histogram.getPercentile(100));
+
+    histogram.clear();
+    EXPECT_EQ(0u, histogram.getCount());
+}
+
+/**
+ * Tests that frames are counted and written to the CSV file
+ */
+TEST_F(FrameProfilerTest, framesStreamedToCsv)
+{
+    {
+        FrameProfiler profiler(std::chrono::microseconds(1000));
+        ASSERT_TRUE(profiler.openCsv(csvFilename));
+
+        for (int i = 0; i < 3; i++) {
+            profiler.beginFrame();
+            profiler.record(PHASE_NEXT_STEP, std::chrono::microseconds(200));
+            if (i == 1) {
+                profiler.record(PHASE_DRAW, std::chrono::milliseconds(5));
+                profiler.record(PHASE_FRAME, std::chrono::milliseconds(5));
+            }
+            {
+                PhaseTimer timer(nullptr, PHASE_DISPLAY);
+            }
+            profiler.endFrame();
+        }
+
+        EXPECT_EQ(3u, profiler.getFrameCount());
+        EXPECT_EQ(1u, profiler.getOverBudgetCount());
+        EXPECT_EQ(3u, profiler.getHistogram(PHASE_NEXT_STEP).getCount());
+        EXPECT_EQ(1u, profiler.getHistogram(PHASE_DRAW).getCount());
+        EXPECT_EQ(0u, profiler.getHistogram(PHASE_DISPLAY).getCount());
+    }
+
+    std::ifstream csvFile(csvFilename);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(csvFile, line)) {
+        lines.push_back(line);
+    }
+
+    ASSERT_EQ(4u, lines.size());
+    EXPECT_EQ(0u, lines[0].find("frame_index,frame_us,handle_events_us,next_step_us"));
+    EXPECT_EQ(0u, lines[2].find("1,"));
+    EXPECT_NE(std::string::npos, lines[2].find(",200,0,5000,"));
+}
+
+/**
+ * Tests that durations of the last and recent frames are kept
+ */
+TEST_F(FrameProfilerTest, recentFrames)
+{
+    FrameProfiler profiler(std::chrono::microseconds(1000));
+    EXPECT_EQ(0u, profiler.getRecentFrameDuration(0));
+
+    for (std::uint32_t i = 1; i <= FrameProfiler::RECENT_FRAME_COUNT + 5; i++) {
+        profiler.beginFrame();
+        profiler.record(PHASE_NEXT_STEP, std::chrono::microseconds(i));
+        profiler.record(PHASE_FRAME, std::chrono::milliseconds(i));
+        profiler.endFrame();
+    }
+
+    const std::uint32_t lastFrame = FrameProfiler::RECENT_FRAME_COUNT + 5;
+    EXPECT_EQ(lastFrame, profiler.getLastDuration(PHASE_NEXT_STEP));
+    EXPECT_EQ(0u, profiler.getLastDuration(PHASE_DRAW));
+    EXPECT_LE(lastFrame * 1000, profiler.getRecentFrameDuration(0));
+    EXPECT_LE((lastFrame - 1) * 1000, profiler.getRecentFrameDuration(1));
+    EXPECT_GT(lastFrame * 1000, profiler.getRecentFrameDuration(1));
+    EXPECT_LE(6000u, profiler.getRecentFrameDuration(FrameProfiler::RECENT_FRAME_COUNT - 1));
+    EXPECT_EQ(0u, profiler.getRecentFrameDuration(FrameProfiler::RECENT_FRAME_COUNT));
+}
+
+} // namespace gtest
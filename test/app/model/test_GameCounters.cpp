@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "model/core/GameCounters.h"
+
+namespace
+{
+
+/**
+ * The test class GameCountersTest
+ * performs tests on the app class CounterArray
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see CounterArray
+ */
+class GameCountersTest: public ::testing::Test
+{
+};
+
+/**
+ * Tests that counters are updated independently and reset to zero
+ */
+TEST_F(GameCountersTest, updateAndReset)
+{
+    GameCounters counters(GAME_COUNTER_KEYS);
+    for (std::size_t i = 0; i < GameCounters::getCount(); i++) {
+        EXPECT_EQ(0, counters.get(static_cast<GameCounter>(i)));
+    }
+
+    counters.increase(CURRENT_COINS, 2);
+    counters.increase(CURRENT_COINS, 3);
+    counters.set(CURRENT_SCORE, 1200);
+
+    EXPECT_EQ(5, counters.get(CURRENT_COINS));
+    EXPECT_EQ(0, counters.get(CURRENT_DISTANCE));
+    EXPECT_EQ(1200, counters.get(CURRENT_SCORE));
+
+    counters.reset();
+    EXPECT_EQ(0, counters.get(CURRENT_COINS));
+    EXPECT_EQ(0, counters.get(CURRENT_SCORE));
+}
+
+/**
+ * Tests that persistence keys are mapped to their counters
+ */
+TEST_F(GameCountersTest, keysMapToCounters)
+{
+    StatCounters counters(STAT_COUNTER_KEYS);
+    StatCounter counter;
+
+    ASSERT_TRUE(counters.findCounter("total_games_played", counter));
+    EXPECT_EQ(TOTAL_GAMES_PLAYED, counter);
+    ASSERT_TRUE(counters.findCounter("per_game_coins_collected", counter));
+    EXPECT_EQ(PER_GAME_COINS_COLLECTED, counter);
+    EXPECT_STREQ("total_distance_travelled", counters.getKey(TOTAL_DISTANCE_TRAVELLED));
+
+    EXPECT_FALSE(counters.findCounter("unknown_stat", counter));
+}
+
+} // namespace gtest
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "model/events/GameEventBuffer.h"
+
+namespace
+{
+
+/**
+ * The test class GameEventBufferTest
+ * performs tests on the app class GameEventBuffer
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see GameEventBuffer
+ */
+class GameEventBufferTest: public ::testing::Test
+{
+};
+
+/**
+ * Tests that each consumer reads all events published after its creation, in order
+ */
+TEST_F(GameEventBufferTest, consumersReadInOrder)
+{
+    GameEventBuffer buffer(6);
+    ASSERT_EQ(8u, buffer.getCapacity());
+
+    buffer.publish(GameEvent{ZONE_TRANSITION_ALLOWED, UNDEFINED, ElementHandle{0, 0}, 0});
+    GameEventCursor firstCursor = buffer.createCursor();
+    GameEventCursor secondCursor = buffer.createCursor();
+
+    for (unsigned long step = 1; step <= 5; step++) {
+        buffer.publish(GameEvent{COIN_COLLECTED, COIN, ElementHandle{1, 0}, step});
+    }
+
+    GameEvent event;
+    for (unsigned long step = 1; step <= 5; step++) {
+        ASSERT_TRUE(buffer.poll(firstCursor, event));
+        EXPECT_EQ(COIN_COLLECTED, event.type);
+        EXPECT_EQ(step, event.step);
+    }
+    EXPECT_FALSE(buffer.poll(firstCursor, event));
+
+    ASSERT_TRUE(buffer.poll(secondCursor, event));
+    EXPECT_EQ(1u, event.step);
+    EXPECT_EQ(0u, secondCursor.dropped);
+}
+
+/**
+ * Tests that a consumer falling behind skips the overwritten events
+ */
+TEST_F(GameEventBufferTest, lateConsumerDropsEvents)
+{
+    GameEventBuffer buffer(4);
+    GameEventCursor cursor = buffer.createCursor();
+
+    for (unsigned long step = 0; step < 10; step++) {
+        buffer.publish(GameEvent{ENEMY_HIT, STANDARD_ENEMY, ElementHandle{2, 1}, step});
+    }
+
+    GameEvent event;
+    ASSERT_TRUE(buffer.poll(cursor, event));
+    EXPECT_EQ(6u, event.step);
+    EXPECT_EQ(6u, cursor.dropped);
+
+    int remaining = 0;
+    while (buffer.poll(cursor, event)) {
+        remaining++;
+    }
+    EXPECT_EQ(3, remaining);
+    EXPECT_EQ(10u, buffer.getPublishedCount());
+}
+
+/**
+ * Tests that a consumer reading while events are published only reads whole events,
+ * each published event being either read or dropped
+ */
+TEST_F(GameEventBufferTest, concurrentConsumer)
+{
+    const unsigned long eventCount = 200000;
+    GameEventBuffer buffer(16);
+    GameEventCursor cursor = buffer.createCursor();
+
+    std::thread producer([&buffer, eventCount]() {
+        for (unsigned long step = 0; step < eventCount; step++) {
+            const auto slot = static_cast<unsigned int>(step);
+            buffer.publish(GameEvent{ENEMY_HIT, STANDARD_ENEMY, ElementHandle{slot, ~slot}, step});
+        }
+    });
+
+    GameEvent event;
+    unsigned long readCount = 0;
+    unsigned long lastStep = 0;
+    bool isConsistent = true;
+
+    while (readCount + cursor.dropped < eventCount) {
+        if (buffer.poll(cursor, event)) {
+            isConsistent = isConsistent && event.handle.slot == static_cast<unsigned int>(event.step)
+                    && event.handle.generation == ~event.handle.slot && (readCount == 0 || event.step > lastStep);
+            lastStep = event.step;
+            readCount++;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(isConsistent);
+    EXPECT_EQ(eventCount, readCount + cursor.dropped);
+    EXPECT_FALSE(buffer.poll(cursor, event));
+}
+
+} // namespace gtest
@@ -0,0 +1,135 @@
+#include <cstdio>
+#include <gtest/gtest.h>
+#include "model/enums/GameState.h"
+#include "model/snapshot/GameSnapshot.h"
+
+namespace
+{
+
+/**
+ * The test class GameSnapshotTest
+ * performs tests on the app class GameSnapshot
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see GameSnapshot
+ */
+class GameSnapshotTest: public ::testing::Test
+{
+protected:
+    const std::string SNAPSHOT_PATH = "test_snapshot.bks";
+
+    void TearDown() override
+    {
+        std::remove(SNAPSHOT_PATH.c_str());
+    }
+};
+
+/**
+ * Tests that values and arrays are read back in writing order, also after saving to a file
+ */
+TEST_F(GameSnapshotTest, valuesRoundTrip)
+{
+    GameSnapshot snapshot;
+    snapshot.write(42);
+    snapshot.write(1.5f);
+    snapshot.writeArray(std::vector<unsigned int>{3, 1, 4, 1, 5});
+    ASSERT_TRUE(snapshot.saveToFile(SNAPSHOT_PATH));
+
+    GameSnapshot loadedSnapshot;
+    ASSERT_TRUE(loadedSnapshot.loadFromFile(SNAPSHOT_PATH));
+    ASSERT_EQ(snapshot.getSize(), loadedSnapshot.getSize());
+
+    int integer;
+    float decimal;
+    std::vector<unsigned int> values;
+    ASSERT_TRUE(loadedSnapshot.read(integer));
+    ASSERT_TRUE(loadedSnapshot.read(decimal));
+    ASSERT_FALSE(loadedSnapshot.readArray(values, 4));
+    loadedSnapshot.rewind();
+    ASSERT_TRUE(loadedSnapshot.read(integer));
+    ASSERT_TRUE(loadedSnapshot.read(decimal));
+    ASSERT_TRUE(loadedSnapshot.readArray(values, 5));
+    EXPECT_EQ(42, integer);
+    EXPECT_EQ(1.5f, decimal);
+    EXPECT_EQ((std::vector<unsigned int>{3, 1, 4, 1, 5}), values);
+    EXPECT_FALSE(loadedSnapshot.read(integer));
+}
+
+/**
+ * Tests that saving again reuses the snapshot's memory
+ */
+TEST_F(GameSnapshotTest, memoryReuse)
+{
+    GameSnapshot snapshot;
+    snapshot.reserve(64);
+    const std::size_t capacity = snapshot.getCapacity();
+
+    for (int i = 0; i < 3; i++) {
+        snapshot.clear();
+        snapshot.writeArray(std::vector<float>(8, 0.5f));
+        EXPECT_EQ(capacity, snapshot.getCapacity());
+    }
+}
+
+/**
+ * Tests that truncated and foreign files are rejected
+ */
+TEST_F(GameSnapshotTest, invalidFile)
+{
+    GameSnapshot snapshot;
+    snapshot.write(7);
+    ASSERT_TRUE(snapshot.saveToFile(SNAPSHOT_PATH));
+
+    FILE* file = std::fopen(SNAPSHOT_PATH.c_str(), "ab");
+    ASSERT_NE(nullptr, file);
+    std::fputc(0, file);
+    std::fclose(file);
+
+    EXPECT_FALSE(snapshot.loadFromFile(SNAPSHOT_PATH));
+    EXPECT_TRUE(snapshot.isEmpty());
+    EXPECT_FALSE(snapshot.loadFromFile("missing_snapshot.bks"));
+}
+
+/**
+ * Tests that a file whose values were altered is rejected by its checksum
+ */
+TEST_F(GameSnapshotTest, corruptedFile)
+{
+    GameSnapshot snapshot;
+    snapshot.writeArray(std::vector<unsigned int>{3, 1, 4, 1, 5});
+    ASSERT_TRUE(snapshot.saveToFile(SNAPSHOT_PATH));
+
+    FILE* file = std::fopen(SNAPSHOT_PATH.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    std::fseek(file, -8, SEEK_END);
+    std::fputc(9, file);
+    std::fclose(file);
+
+    EXPECT_FALSE(snapshot.loadFromFile(SNAPSHOT_PATH));
+    EXPECT_TRUE(snapshot.isEmpty());
+}
+
+/**
+ * Tests that booleans and enums out of their range are rejected
+ */
+TEST_F(GameSnapshotTest, checkedValues)
+{
+    GameSnapshot snapshot;
+    snapshot.write(true);
+    snapshot.write(static_cast<unsigned char>(2));
+    snapshot.write(OVER);
+    snapshot.write(static_cast<GameState>(OVER + 1));
+
+    bool boolean = false;
+    GameState state = RUNNING;
+    EXPECT_TRUE(snapshot.read(boolean));
+    EXPECT_TRUE(boolean);
+    EXPECT_FALSE(snapshot.read(boolean));
+    EXPECT_TRUE(snapshot.readEnum(state, RUNNING, OVER));
+    EXPECT_EQ(OVER, state);
+    EXPECT_FALSE(snapshot.readEnum(state, RUNNING, OVER));
+}
+
+} // namespace gtest
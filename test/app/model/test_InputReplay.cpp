@@ -0,0 +1,85 @@
+#include <cstdio>
+#include <gtest/gtest.h>
+#include "model/replay/InputRecorder.h"
+#include "model/replay/InputReplay.h"
+
+namespace
+{
+
+/**
+ * The test class InputReplayTest
+ * performs tests on the app classes InputRecorder and InputReplay
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see InputRecorder
+ * @see InputReplay
+ */
+class InputReplayTest: public ::testing::Test
+{
+protected:
+    const std::string REPLAY_PATH = "test_replay.bkr";
+
+    void TearDown() override
+    {
+        std::remove(REPLAY_PATH.c_str());
+    }
+};
+
+/**
+ * Tests that a recording is read back with its header and all its steps
+ */
+TEST_F(InputReplayTest, recordingRoundTrip)
+{
+    const ReplayHeader header{0x123456789abcdefULL, 2, 900, 600, {"shop_doubler", "shop_fly_plus"}};
+    const unsigned int inputs[] = {0, 0, 0, 4, 4, 1, 0, 0, 2, 8};
+    const unsigned int events[] = {0, 0, 1, 0, 0, 0, 0, 6, 0, 16};
+
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.open(REPLAY_PATH, header));
+    for (int i = 0; i < 10; i++) {
+        recorder.recordStep(inputs[i], events[i]);
+    }
+    recorder.close();
+    ASSERT_EQ(10u, recorder.getStepCount());
+
+    InputReplay replay;
+    ASSERT_TRUE(replay.load(REPLAY_PATH));
+    EXPECT_EQ(header.seed, replay.getHeader().seed);
+    EXPECT_EQ(header.difficulty, replay.getHeader().difficulty);
+    EXPECT_EQ(header.width, replay.getHeader().width);
+    EXPECT_EQ(header.height, replay.getHeader().height);
+    EXPECT_EQ(header.activatedItems, replay.getHeader().activatedItems);
+    ASSERT_EQ(10u, replay.getStepCount());
+
+    unsigned int input, event;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(replay.readNextStep(input, event));
+        EXPECT_EQ(inputs[i], input);
+        EXPECT_EQ(events[i], event);
+    }
+    EXPECT_TRUE(replay.isFinished());
+    EXPECT_FALSE(replay.readNextStep(input, event));
+
+    replay.rewind();
+    ASSERT_TRUE(replay.readNextStep(input, event));
+    EXPECT_EQ(inputs[0], input);
+}
+
+/**
+ * Tests that a file which isn't a recording is rejected
+ */
+TEST_F(InputReplayTest, invalidRecording)
+{
+    FILE* file = std::fopen(REPLAY_PATH.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    std::fputs("<runner></runner>", file);
+    std::fclose(file);
+
+    InputReplay replay;
+    EXPECT_FALSE(replay.load(REPLAY_PATH));
+    EXPECT_FALSE(replay.load("missing_replay.bkr"));
+}
+
+} // namespace gtest
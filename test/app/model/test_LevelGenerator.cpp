@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "model/enums/Difficulty.h"
+#include "model/level/LevelGenerator.h"
+
+namespace
+{
+
+/**
+ * The test class LevelGeneratorTest
+ * performs tests on the app class LevelGenerator
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see LevelGenerator
+ */
+class LevelGeneratorTest: public ::testing::Test
+{
+protected:
+    static std::vector<LevelEntry> drain(LevelGenerator& generator)
+    {
+        std::vector<LevelEntry> entries;
+        LevelEntry entry{};
+
+        while (generator.peek(entry)) {
+            entries.push_back(entry);
+            generator.pop();
+        }
+
+        return entries;
+    }
+
+    static bool isObstacle(const LevelEntry& entry)
+    {
+        return entry.type == STANDARD_ENEMY || entry.type == TOTEM_ENEMY || entry.type == BLOCK_ENEMY;
+    }
+};
+
+/**
+ * Tests that a seed always generates the same level
+ */
+TEST_F(LevelGeneratorTest, seedReproducesLevel)
+{
+    RandomGenerator firstRandom(42), secondRandom(42);
+    LevelGenerator first(firstRandom, EASY, 900, 102, 20);
+    LevelGenerator second(secondRandom, EASY, 900, 102, 20);
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(first.generateChunk(5.0f + i));
+        ASSERT_TRUE(second.generateChunk(5.0f + i));
+    }
+
+    const std::vector<LevelEntry> firstEntries = drain(first);
+    const std::vector<LevelEntry> secondEntries = drain(second);
+
+    ASSERT_EQ(firstEntries.size(), secondEntries.size());
+    ASSERT_FALSE(firstEntries.empty());
+    for (std::size_t i = 0; i < firstEntries.size(); i++) {
+        EXPECT_EQ(firstEntries[i].position, secondEntries[i].position);
+        EXPECT_EQ(firstEntries[i].height, secondEntries[i].height);
+        EXPECT_EQ(firstEntries[i].type, secondEntries[i].type);
+    }
+}
+
+/**
+ * Tests that queued elements are sorted, and that obstacles and coins can be handled by the player
+ */
+TEST_F(LevelGeneratorTest, chunksAreValid)
+{
+    const int speed = 10;
+    RandomGenerator random(7);
+    LevelGenerator generator(random, HARD, 900, 102, 20);
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(generator.generateChunk(speed));
+    }
+    EXPECT_EQ(900u + 3 * 1024u, generator.getGeneratedLength());
+
+    const std::vector<LevelEntry> entries = drain(generator);
+    std::uint32_t previousObstacle = 0;
+
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        const LevelEntry& entry = entries[i];
+        EXPECT_GE(entry.position, 900u);
+        EXPECT_LT(entry.position, generator.getGeneratedLength());
+        if (i > 0) {
+            EXPECT_LE(entries[i - 1].position, entry.position);
+        }
+
+        if (isObstacle(entry)) {
+            if (previousObstacle != 0) {
+                EXPECT_GE(entry.position - previousObstacle, 36u * speed);
+            }
+            previousObstacle = entry.position;
+        } else if (entry.type == COIN) {
+            EXPECT_LE(entry.height, 100);
+            for (const LevelEntry& obstacle : entries) {
+                const auto type = static_cast<MovableElementType>(obstacle.type);
+                if (isObstacle(obstacle) && obstacle.position < entry.position + 25
+                        && entry.position < obstacle.position + Enemy::getTypeWidth(type)) {
+                    EXPECT_GE(entry.height, Enemy::getTypeHeight(type));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Tests that no chunk is generated when the queue can't hold it
+ */
+TEST_F(LevelGeneratorTest, fullQueueRefusesChunks)
+{
+    RandomGenerator random(3);
+    LevelGenerator generator(random, EASY, 0, 102, 20);
+
+    int generatedChunks = 0;
+    while (generator.generateChunk(1.0f)) {
+        generatedChunks++;
+    }
+
+    EXPECT_GT(generatedChunks, 0);
+    EXPECT_LE(generator.getQueuedCount(), LevelGenerator::getCapacity());
+
+    const std::uint32_t generatedLength = generator.getGeneratedLength();
+    EXPECT_FALSE(generator.generateChunk(1.0f));
+    EXPECT_EQ(generatedLength, generator.getGeneratedLength());
+
+    drain(generator);
+    EXPECT_TRUE(generator.generateChunk(1.0f));
+}
+
+/**
+ * Tests that a restored generator continues the same level
+ */
+TEST_F(LevelGeneratorTest, snapshotRestoresQueue)
+{
+    RandomGenerator random(11);
+    LevelGenerator generator(random, EASY, 900, 102, 20);
+    generator.generateChunk(8.0f);
+    generator.pop();
+
+    GameSnapshot snapshot;
+    generator.saveSnapshot(snapshot);
+    const std::uint64_t state = random.getState();
+
+    generator.generateChunk(8.0f);
+    const std::vector<LevelEntry> expected = drain(generator);
+
+    RandomGenerator restoredRandom(0);
+    restoredRandom.restore(11, state, random.getIncrement());
+    LevelGenerator restored(restoredRandom, EASY, 0, 102, 20);
+    ASSERT_TRUE(restored.restoreSnapshot(snapshot));
+    EXPECT_EQ(1u, restored.getChunkCount());
+
+    restored.generateChunk(8.0f);
+    const std::vector<LevelEntry> entries = drain(restored);
+
+    ASSERT_EQ(expected.size(), entries.size());
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        EXPECT_EQ(expected[i].position, entries[i].position);
+        EXPECT_EQ(expected[i].type, entries[i].type);
+    }
+}
+
+} // namespace gtest
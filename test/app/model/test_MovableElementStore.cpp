@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "model/game-components/MovableElementStore.h"
+
+namespace
+{
+
+/**
+ * The test class MovableElementStoreTest
+ * performs tests on the app class MovableElementStore
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see MovableElementStore
+ */
+class MovableElementStoreTest: public ::testing::Test
+{
+protected:
+    static ElementHandle createCoin(MovableElementStore& store, float x)
+    {
+        return store.create(x, 100, 25, 25, -1, COIN);
+    }
+
+    /**
+     * Writes the snapshot of a store of capacity 2 whose arrays are empty,
+     * except the given x-positions and free slots
+     */
+    static void writeEmptyStore(GameSnapshot& snapshot, const std::vector<float>& positions,
+                                const std::vector<unsigned int>& freeSlots)
+    {
+        snapshot.clear();
+        snapshot.write(static_cast<std::uint64_t>(2));
+        snapshot.writeArray(positions);
+        for (int i = 0; i < 6; i++) {
+            snapshot.writeArray(std::vector<float>());
+        }
+        snapshot.writeArray(std::vector<MovableElementType>());
+        snapshot.writeArray(std::vector<unsigned char>());
+        snapshot.writeArray(std::vector<unsigned int>());
+        snapshot.writeArray(std::vector<std::size_t>{0, 0});
+        snapshot.writeArray(std::vector<unsigned int>{0, 0});
+        snapshot.writeArray(freeSlots);
+    }
+};
+
+/**
+ * Tests that a removed element's slot is recycled with a new generation,
+ * the removed element's handle being rejected
+ */
+TEST_F(MovableElementStoreTest, slotReuse)
+{
+    MovableElementStore store(4);
+    const ElementHandle first = createCoin(store, 10);
+    const ElementHandle second = createCoin(store, 20);
+    ASSERT_NE(first.slot, second.slot);
+
+    store.destroy(first);
+    EXPECT_FALSE(store.isAlive(first));
+    EXPECT_TRUE(store.isAlive(second));
+
+    const ElementHandle third = createCoin(store, 30);
+    EXPECT_EQ(first.slot, third.slot);
+    EXPECT_EQ(first.generation + 1, third.generation);
+    EXPECT_FALSE(store.isAlive(first));
+    EXPECT_TRUE(store.isAlive(third));
+
+    store.destroy(first);
+    EXPECT_TRUE(store.isAlive(third));
+    EXPECT_EQ(2u, store.getSize());
+    EXPECT_EQ(30, store.getPosX(store.getIndex(third)));
+}
+
+/**
+ * Tests that removing an element moves the last one in its place,
+ * handles still giving access to the moved element
+ */
+TEST_F(MovableElementStoreTest, swapRemoveFixesIndexes)
+{
+    MovableElementStore store(4);
+    const ElementHandle first = createCoin(store, 10);
+    const ElementHandle second = createCoin(store, 20);
+    const ElementHandle last = store.create(30, 50, 40, 60, -1, STANDARD_ENEMY);
+
+    store.destroy(first);
+
+    ASSERT_EQ(2u, store.getSize());
+    EXPECT_EQ(0u, store.getIndex(last));
+    EXPECT_EQ(last, store.getHandle(0));
+    EXPECT_EQ(30, store.getPosX(0));
+    EXPECT_EQ(50, store.getPosY(0));
+    EXPECT_EQ(40, store.getWidth(0));
+    EXPECT_EQ(60, store.getHeight(0));
+    EXPECT_EQ(STANDARD_ENEMY, store.getType(0));
+    EXPECT_EQ(1u, store.getIndex(second));
+    EXPECT_EQ(20, store.getPosX(store.getIndex(second)));
+}
+
+/**
+ * Tests that the store is full once all slots are used, until an element is removed
+ */
+TEST_F(MovableElementStoreTest, capacityExhaustion)
+{
+    MovableElementStore store(3);
+    std::vector<ElementHandle> handles;
+
+    while (!store.isFull()) {
+        handles.push_back(createCoin(store, static_cast<float>(handles.size())));
+    }
+
+    EXPECT_EQ(3u, handles.size());
+    EXPECT_EQ(3u, store.getSize());
+    EXPECT_EQ(0u, store.getPooledCount());
+
+    store.destroy(handles[1]);
+    EXPECT_FALSE(store.isFull());
+    EXPECT_EQ(1u, store.getPooledCount());
+
+    store.destroy(handles[1]);
+    EXPECT_EQ(1u, store.getPooledCount());
+
+    store.clear();
+    EXPECT_EQ(0u, store.getSize());
+    EXPECT_EQ(3u, store.getPooledCount());
+}
+
+/**
+ * Tests that a restored store holds the same elements and recycles the same slots
+ */
+TEST_F(MovableElementStoreTest, snapshotRoundTrip)
+{
+    MovableElementStore store(4);
+    const ElementHandle first = createCoin(store, 10);
+    const ElementHandle second = createCoin(store, 20);
+    store.destroy(first);
+
+    GameSnapshot snapshot;
+    store.saveSnapshot(snapshot);
+
+    MovableElementStore restored(4);
+    ASSERT_TRUE(restored.restoreSnapshot(snapshot));
+    EXPECT_EQ(1u, restored.getSize());
+    EXPECT_FALSE(restored.isAlive(first));
+    ASSERT_TRUE(restored.isAlive(second));
+    EXPECT_EQ(20, restored.getPosX(restored.getIndex(second)));
+
+    const ElementHandle created = createCoin(store, 30);
+    EXPECT_EQ(created, createCoin(restored, 30));
+
+    MovableElementStore smallerStore(3);
+    snapshot.rewind();
+    EXPECT_FALSE(smallerStore.restoreSnapshot(snapshot));
+}
+
+/**
+ * Tests that snapshots of inconsistent stores are rejected
+ */
+TEST_F(MovableElementStoreTest, invalidSnapshot)
+{
+    MovableElementStore store(2);
+    GameSnapshot snapshot;
+
+    writeEmptyStore(snapshot, std::vector<float>(), std::vector<unsigned int>{1, 0});
+    EXPECT_TRUE(store.restoreSnapshot(snapshot));
+
+    writeEmptyStore(snapshot, std::vector<float>(), std::vector<unsigned int>{0, 0});
+    EXPECT_FALSE(store.restoreSnapshot(snapshot));
+
+    writeEmptyStore(snapshot, std::vector<float>(), std::vector<unsigned int>{1, 2});
+    EXPECT_FALSE(store.restoreSnapshot(snapshot));
+
+    writeEmptyStore(snapshot, std::vector<float>(), std::vector<unsigned int>{1});
+    EXPECT_FALSE(store.restoreSnapshot(snapshot));
+
+    writeEmptyStore(snapshot, std::vector<float>{10}, std::vector<unsigned int>{1});
+    EXPECT_FALSE(store.restoreSnapshot(snapshot));
+}
+
+} // namespace gtest
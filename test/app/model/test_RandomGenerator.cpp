@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "model/utils/RandomGenerator.h"
+
+namespace
+{
+
+/**
+ * The test class RandomGeneratorTest
+ * performs tests on the app class RandomGenerator
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ *
+ * @see RandomGenerator
+ */
+class RandomGeneratorTest: public ::testing::Test
+{
+};
+
+/**
+ * Tests RandomGenerator::next() function against the PCG32 reference sequence
+ */
+TEST_F(RandomGeneratorTest, referenceSequence)
+{
+    RandomGenerator generator(42, 54);
+    const std::uint32_t expected[] = {0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e};
+
+    for (std::uint32_t value : expected) {
+        ASSERT_EQ(value, generator.next());
+    }
+}
+
+/**
+ * Tests that a seed reproduces a sequence, also after reseeding
+ */
+TEST_F(RandomGeneratorTest, seedReproducesSequence)
+{
+    RandomGenerator generator(1234);
+    RandomGenerator sameGenerator(1234);
+    RandomGenerator otherGenerator(1235);
+    bool isOtherSequenceDifferent = false;
+    int firstNumbers[100];
+
+    for (int& number : firstNumbers) {
+        number = generator.getUniformRandomNumber(0, 1000);
+        ASSERT_EQ(number, sameGenerator.getUniformRandomNumber(0, 1000));
+        isOtherSequenceDifferent |= number != otherGenerator.getUniformRandomNumber(0, 1000);
+    }
+    ASSERT_TRUE(isOtherSequenceDifferent);
+    ASSERT_EQ(1234u, generator.getSeed());
+
+    generator.seed(1234);
+    for (int number : firstNumbers) {
+        ASSERT_EQ(number, generator.getUniformRandomNumber(0, 1000));
+    }
+}
+
+/**
+ * Tests on RandomGenerator::getUniformRandomNumber() function bounds
+ */
+TEST_F(RandomGeneratorTest, uniformRandomNumberBounds)
+{
+    RandomGenerator generator(7);
+    bool isMinDrawn = false, isMaxDrawn = false;
+
+    for (int i = 0; i < 10000; i++) {
+        int number = generator.getUniformRandomNumber(-3, 3);
+        ASSERT_GE(number, -3);
+        ASSERT_LE(number, 3);
+        isMinDrawn |= number == -3;
+        isMaxDrawn |= number == 3;
+    }
+    ASSERT_TRUE(isMinDrawn);
+    ASSERT_TRUE(isMaxDrawn);
+    ASSERT_EQ(5, generator.getUniformRandomNumber(5, 5));
+}
+
+} // namespace gtest
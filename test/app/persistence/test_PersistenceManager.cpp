@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <thread>
 #include <persistence/PersistenceException.h>
 #include "persistence/PersistenceManager.h"
 #include "../core/TestCore.h"
@@ -81,6 +82,21 @@ TEST_F(PersistenceManagerTest, checkInitializedContext)
     }
 }
 
+/**
+ * Tests that the context is bound to the thread which initialized it
+ */
+TEST_F(PersistenceManagerTest, threadBoundContext)
+{
+    bool isInitInOtherThread = true;
+    PersistenceManager::initContext(testCore);
+
+    std::thread otherThread([&isInitInOtherThread]() { isInitInOtherThread = PersistenceManager::isInit(); });
+    otherThread.join();
+
+    ASSERT_TRUE(PersistenceManager::isInit());
+    ASSERT_FALSE(isInitInOtherThread);
+}
+
 /**
  * Tests on PersistenceManager::initPersistence() function
  */
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Logger/LogQueue.h"
+
+using Bokoblin::SimpleLogger::LogQueue;
+using Bokoblin::SimpleLogger::LogRecord;
+using Bokoblin::SimpleLogger::LOG_INFO;
+using Bokoblin::SimpleLogger::LOG_ERROR;
+
+namespace
+{
+
+/**
+ * This test class performs tests on the class LogQueue
+ * from the library Logger
+ */
+class LogQueueTest: public ::testing::Test {
+protected:
+    static bool push(LogQueue& queue, const std::string& text)
+    {
+        return queue.tryPush(LOG_INFO, text.data(), text.size());
+    }
+};
+
+/**
+ * Tests that lines are popped in push order until the queue is full
+ */
+TEST_F(LogQueueTest, pushAndPop)
+{
+    LogQueue queue(3);
+    ASSERT_EQ(4u, queue.getCapacity());
+
+    LogRecord record{};
+    EXPECT_FALSE(queue.tryPop(record));
+
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(push(queue, "line " + std::to_string(i)));
+    }
+    EXPECT_FALSE(push(queue, "line 4"));
+
+    ASSERT_TRUE(queue.tryPop(record));
+    EXPECT_EQ("line 0", std::string(record.text, record.length));
+    EXPECT_TRUE(queue.tryPush(LOG_ERROR, "error", 5));
+
+    for (int i = 1; i < 4; i++) {
+        ASSERT_TRUE(queue.tryPop(record));
+        EXPECT_EQ("line " + std::to_string(i), std::string(record.text, record.length));
+    }
+    ASSERT_TRUE(queue.tryPop(record));
+    EXPECT_EQ(LOG_ERROR, record.level);
+    EXPECT_FALSE(queue.tryPop(record));
+}
+
+/**
+ * Tests that long lines are truncated with a marker
+ */
+TEST_F(LogQueueTest, longLineTruncated)
+{
+    LogQueue queue(2);
+    const std::string text(LogRecord::TEXT_CAPACITY + 10, 'a');
+    ASSERT_TRUE(push(queue, text));
+
+    LogRecord record{};
+    ASSERT_TRUE(queue.tryPop(record));
+    EXPECT_EQ(LogRecord::TEXT_CAPACITY, record.length);
+    EXPECT_EQ(text.substr(0, LogRecord::TEXT_CAPACITY - 5) + "[...]", std::string(record.text, record.length));
+}
+
+/**
+ * Tests that lines pushed by several threads are all popped,
+ * in push order for each thread
+ */
+TEST_F(LogQueueTest, concurrentProducers)
+{
+    const int producerCount = 4;
+    const int lineCount = 5000;
+    LogQueue queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; p++) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < lineCount; i++) {
+                const std::string text = std::to_string(p) + " " + std::to_string(i);
+                while (!push(queue, text)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextLines(producerCount, 0);
+    LogRecord record{};
+    int poppedCount = 0;
+
+    while (poppedCount < producerCount * lineCount) {
+        if (queue.tryPop(record)) {
+            const std::string text(record.text, record.length);
+            const int producer = std::stoi(text.substr(0, text.find(' ')));
+            EXPECT_EQ(nextLines[producer], std::stoi(text.substr(text.find(' ') + 1)));
+            nextLines[producer]++;
+            poppedCount++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(queue.tryPop(record));
+}
+
+} // namespace gtest
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "Logger/LogWriter.h"
+
+using Bokoblin::SimpleLogger::LogRecord;
+using Bokoblin::SimpleLogger::LogWriter;
+using Bokoblin::SimpleLogger::LOG_INFO;
+
+namespace
+{
+
+/**
+ * This test class performs tests on the class LogWriter
+ * from the library Logger
+ */
+class LogWriterTest: public ::testing::Test {
+protected:
+    const std::string LOG_FILE = "test_log_writer.log";
+
+    void TearDown() override
+    {
+        remove(LOG_FILE.c_str());
+    }
+
+    std::string readFile() const
+    {
+        std::ifstream file(LOG_FILE.c_str());
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+};
+
+/**
+ * Tests that lines logged while the writer stops are all written
+ */
+TEST_F(LogWriterTest, stopWhileLogging)
+{
+    const int threadCount = 4;
+    const int lineCount = 2000;
+    {
+        LogWriter writer;
+        ASSERT_TRUE(writer.setFile(LOG_FILE));
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&writer, lineCount]() {
+                for (int i = 0; i < lineCount; i++) {
+                    writer.write(LOG_INFO, "line " + std::to_string(i));
+                }
+            });
+        }
+
+        std::this_thread::yield();
+        writer.stop();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    const std::string content = readFile();
+    EXPECT_EQ(threadCount * lineCount, std::count(content.begin(), content.end(), '\n'));
+}
+
+/**
+ * Tests that lines too long to be queued are written whole, after previous lines
+ */
+TEST_F(LogWriterTest, longLineNotTruncated)
+{
+    const std::string longLine(LogRecord::TEXT_CAPACITY * 4, 'a');
+    {
+        LogWriter writer;
+        ASSERT_TRUE(writer.setFile(LOG_FILE));
+        writer.write(LOG_INFO, "first");
+        writer.write(LOG_INFO, longLine);
+    }
+
+    EXPECT_EQ("[INFO] first\n[INFO] " + longLine + "\n", readFile());
+}
+
+} // namespace gtest
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include "Logger/Logger.h"
+
+using Bokoblin::SimpleLogger::Logger;
+using Bokoblin::SimpleLogger::LogLevel;
+using Bokoblin::SimpleLogger::LOG_DEBUG;
+using Bokoblin::SimpleLogger::LOG_INFO;
+using Bokoblin::SimpleLogger::LOG_WARNING;
+using Bokoblin::SimpleLogger::LOG_ERROR;
+
+namespace
+{
+
+/**
+ * This test class performs tests on the class Logger
+ * from the library Logger
+ */
+class LoggerTest: public ::testing::Test {
+protected:
+    LogLevel previousLevel = Logger::getLevel();
+
+    void TearDown() override
+    {
+        Logger::setLevel(previousLevel);
+    }
+};
+
+/**
+ * Tests on Logger::setLevel() and Logger::isEnabled() functions
+ */
+TEST_F(LoggerTest, runtimeLevel)
+{
+    Logger::setLevel(LOG_WARNING);
+    EXPECT_EQ(LOG_WARNING, Logger::getLevel());
+    EXPECT_FALSE(Logger::isEnabled(LOG_DEBUG));
+    EXPECT_FALSE(Logger::isEnabled(LOG_INFO));
+    EXPECT_EQ(Logger::isCompiled(LOG_WARNING), Logger::isEnabled(LOG_WARNING));
+    EXPECT_EQ(Logger::isCompiled(LOG_ERROR), Logger::isEnabled(LOG_ERROR));
+
+    Logger::setLevel(LOG_DEBUG);
+    EXPECT_EQ(Logger::isCompiled(LOG_DEBUG), Logger::isEnabled(LOG_DEBUG));
+}
+
+/**
+ * Tests that levels below the compiled minimum are never enabled
+ */
+TEST_F(LoggerTest, compiledLevel)
+{
+    Logger::setLevel(LOG_DEBUG);
+    const LogLevel levels[] = {LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR};
+
+    for (const LogLevel& level : levels) {
+        EXPECT_EQ(level >= Logger::COMPILED_MIN_LEVEL, Logger::isCompiled(level));
+        EXPECT_EQ(Logger::isCompiled(level), Logger::isEnabled(level));
+    }
+}
+
+} // namespace gtest
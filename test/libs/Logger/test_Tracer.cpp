@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "Logger/Tracer.h"
+
+using Bokoblin::SimpleLogger::Tracer;
+
+namespace
+{
+
+/**
+ * This test class performs tests on the class Tracer
+ * from the library Logger
+ */
+class TracerTest: public ::testing::Test {
+protected:
+    const std::string TRACE_FILE = "test_trace.json";
+
+    void SetUp() override
+    {
+        Tracer::clear();
+    }
+
+    void TearDown() override
+    {
+        Tracer::clear();
+        remove(TRACE_FILE.c_str());
+    }
+
+    static std::string readFile(const std::string& filename)
+    {
+        std::ifstream file(filename.c_str());
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+};
+
+/**
+ * Tests that events of several threads are written as complete events
+ */
+TEST_F(TracerTest, dumpEvents)
+{
+    Tracer::setThreadName("test \"main\"");
+    Tracer::record("test", "first", 1000, 3500);
+
+    std::thread worker([]() {
+        Tracer::record("test", "second", 2000, 2250);
+    });
+    worker.join();
+
+    EXPECT_EQ(2u, Tracer::getEventCount());
+    ASSERT_TRUE(Tracer::dump(TRACE_FILE));
+
+    const std::string trace = readFile(TRACE_FILE);
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"test \\\"main\\\"\"}"));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"first\",\"cat\":\"test\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("\"ts\":1.000,\"dur\":2.500}"));
+    EXPECT_NE(std::string::npos, trace.find("\"ts\":2.000,\"dur\":0.250}"));
+}
+
+/**
+ * Tests that scoped timers only record events when tracing is compiled in
+ */
+TEST_F(TracerTest, scopedTimer)
+{
+    {
+        TRACE_SCOPE("test", "scope");
+    }
+    EXPECT_EQ(Tracer::isCompiled() ? 1u : 0u, Tracer::getEventCount());
+    EXPECT_EQ(0u, Tracer::getDroppedCount());
+}
+
+} // namespace gtest
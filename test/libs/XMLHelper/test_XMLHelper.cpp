@@ -82,6 +82,57 @@ TEST_F(XMLHelperTest, loadXMLFile)
     ASSERT_TRUE(XMLHelper::loadXMLFile(document, filename));
 }
 
+/**
+ * Tests on XMLHelper::loadXMLFile() function with a mapped document
+ */
+TEST_F(XMLHelperTest, loadMappedXMLFile)
+{
+    Bokoblin::XMLUtils::MappedXMLDocument document;
+    ASSERT_FALSE(XMLHelper::loadXMLFile(document, filename));
+    XMLHelper::createXMLFile(filename, "azdzdzd");
+    ASSERT_FALSE(XMLHelper::loadXMLFile(document, filename));
+    XMLHelper::createXMLFile(filename, R"(<?xml version="1.0"?><node value="mapped &amp; parsed"></node>)");
+    ASSERT_TRUE(XMLHelper::loadXMLFile(document, filename));
+    EXPECT_STREQ("mapped & parsed", document.getDocument().child("node").attribute("value").value());
+}
+
+/**
+ * Tests that writing to a writable mapping doesn't modify the file
+ */
+TEST_F(XMLHelperTest, writableMappedFile)
+{
+    XMLHelper::createXMLFile(filename, validContent);
+    Bokoblin::XMLUtils::MappedFile file;
+    ASSERT_TRUE(file.open(filename));
+    EXPECT_EQ(nullptr, file.getWritableData());
+
+    ASSERT_TRUE(file.open(filename, true));
+    ASSERT_EQ(validContent.size(), file.getSize());
+    file.getWritableData()[0] = '#';
+    EXPECT_EQ('#', file.getData()[0]);
+
+    Bokoblin::XMLUtils::MappedFile otherFile;
+    ASSERT_TRUE(otherFile.open(filename));
+    EXPECT_EQ(validContent, std::string(otherFile.getData(), otherFile.getSize()));
+}
+
+/**
+ * Tests on XMLHelper::saveXMLFile() function, replacing the file of a mapped document
+ */
+TEST_F(XMLHelperTest, saveXMLFile)
+{
+    XMLHelper::createXMLFile(filename, R"(<?xml version="1.0"?><node value="first"></node>)");
+    Bokoblin::XMLUtils::MappedXMLDocument document;
+    ASSERT_TRUE(XMLHelper::loadXMLFile(document, filename));
+
+    document.getDocument().child("node").attribute("value").set_value("second");
+    ASSERT_TRUE(XMLHelper::saveXMLFile(document.getDocument(), filename));
+    EXPECT_FALSE(access((filename + ".tmp").c_str(), F_OK) != -1);
+
+    ASSERT_TRUE(XMLHelper::loadXMLFile(document, filename));
+    EXPECT_STREQ("second", document.getDocument().child("node").attribute("value").value());
+}
+
 /**
  * Tests on XMLHelper::loadLabeledString() function
  */
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <regex>
+#include <model/core/ModelConstants.h>
+#include "XMLHelper/XMLValueValidator.h"
+
+using Bokoblin::XMLUtils::XMLValueValidator;
+namespace ModelResources = Bokoblin::BokoRunner::Resources::Model;
+
+namespace
+{
+
+/**
+ * This test class performs tests on the class XMLValueValidator
+ * from the library XMLHelper
+ */
+class XMLValueValidatorTest: public ::testing::Test {
+protected:
+    const std::vector<std::string> values = {
+            "", "0", "00", "7", "42", "042", "-1", "1.5", "12a", " 1", "true", "false", "True", "truefalse",
+            "en", "fr", "es", "e", "enfr", "1", "2", "12", "moblin", "pokeball", "shop_bubble", "shop_extra_life",
+            "shop_", "shop_x_y_z", "|", "en|fr"
+    };
+};
+
+/**
+ * Tests that validators accept exactly the values matched by their regex
+ */
+TEST_F(XMLValueValidatorTest, matchesLikeRegex)
+{
+    const std::vector<std::string> patterns = {
+            ModelResources::INTEGER_REGEX, ModelResources::BOOLEAN_REGEX, "0|[1-9][0-9]*",
+            "en|fr|es", "1|2", "moblin|morphing|pokeball", "shop_[a-z]+[_]{0,1}[a-z]+"
+    };
+
+    for (const std::string& pattern : patterns) {
+        const std::regex regex(pattern);
+        for (const std::string& value : values) {
+            EXPECT_EQ(std::regex_match(value, regex), XMLValueValidator::matches(value.c_str(), pattern))
+                    << "pattern \"" << pattern << "\", value \"" << value << '"';
+        }
+    }
+}
+
+/**
+ * Tests that each pattern is compiled once, and that empty and invalid patterns are handled
+ */
+TEST_F(XMLValueValidatorTest, cachedPatterns)
+{
+    XMLValueValidator::matches("1", "1|2|3");
+    const std::size_t validatorCount = XMLValueValidator::getCachedValidatorCount();
+    XMLValueValidator::matches("4", "1|2|3");
+    EXPECT_EQ(validatorCount, XMLValueValidator::getCachedValidatorCount());
+
+    EXPECT_TRUE(XMLValueValidator::matches("anything", ""));
+    EXPECT_EQ(validatorCount, XMLValueValidator::getCachedValidatorCount());
+
+    EXPECT_FALSE(XMLValueValidator::matches("a", "[a-"));
+    EXPECT_EQ(validatorCount + 1, XMLValueValidator::getCachedValidatorCount());
+}
+
+} // namespace gtest
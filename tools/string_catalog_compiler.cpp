@@ -0,0 +1,168 @@
+/* Copyright 2026 Jolivet Arthur
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <app/localization/LocalizedStringCatalog.h>
+#include <app/model/core/ModelConstants.h>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <vector>
+
+namespace Resources = Bokoblin::BokoRunner::Resources::Model;
+
+/**
+ * Converts a label to the name of its StringIds constant
+ *
+ * @param label the label, made of lowercase letters, digits and underscores
+ * @return the constant name, empty if the label can't be one
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+static std::string getConstantName(const std::string& label)
+{
+    std::string name;
+
+    for (const char character : label) {
+        if (!std::isalnum(static_cast<unsigned char>(character)) && character != '_') {
+            return "";
+        }
+        name.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(character))));
+    }
+
+    return name.empty() || std::isdigit(static_cast<unsigned char>(name[0])) ? "" : name;
+}
+
+/**
+ * Writes the header declaring the StringIds constant of each label
+ *
+ * @param filename the header file name
+ * @param labels the labels, sorted
+ * @return true if the header was written
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+static bool writeIdsHeader(const std::string& filename, const std::set<std::string>& labels)
+{
+    std::ofstream file(filename.c_str(), std::ios::out | std::ios::trunc);
+
+    file << "//Generated by string_catalog_compiler, do not edit\n\n"
+         << "#ifndef LOCALIZED_STRING_IDS_H\n"
+         << "#define LOCALIZED_STRING_IDS_H\n\n"
+         << "#include \"app/localization/StringCatalogFormat.h\"\n"
+         << "#include \"app/model/utils/StringHash.h\"\n\n"
+         << "namespace StringIds\n{\n";
+
+    for (const std::string& label : labels) {
+        file << "constexpr StringId " << getConstantName(label) << " = hash(\"" << label << "\");\n";
+    }
+
+    file << "}\n\n#endif\n";
+    file.close();
+    return !file.fail();
+}
+
+/**
+ * Compiles language files to binary string catalogs and generates the StringIds header. \n
+ * Usage: --header FILE --output-dir DIR LANGUAGE_FILE... \n
+ * The first language file is the reference: all others must define the same labels,
+ * so that a label referenced in the code exists in every language.
+ * Each catalog is named after its language file, with the compiled strings extension.
+ *
+ * @param argc the number of arguments
+ * @param argv the arguments
+ * @return the exit status
+ *
+ * @author Arthur
+ * @date 17/10/2026
+ */
+int main(int argc, char* argv[])
+{
+    std::string headerFilename;
+    std::string outputDirectory;
+    std::vector<std::string> languageFiles;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--header") == 0 && i + 1 < argc) {
+            headerFilename = argv[++i];
+        } else if (strcmp(argv[i], "--output-dir") == 0 && i + 1 < argc) {
+            outputDirectory = argv[++i];
+        } else {
+            languageFiles.emplace_back(argv[i]);
+        }
+    }
+
+    if (headerFilename.empty() || outputDirectory.empty() || languageFiles.empty()) {
+        std::cerr << "Usage: " << argv[0] << " --header FILE --output-dir DIR LANGUAGE_FILE..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::set<std::string> referenceLabels;
+
+    for (const std::string& languageFile : languageFiles) {
+        StringCatalogFormat::Entries entries;
+        if (!LocalizedStringCatalog::readLanguageFile(languageFile, entries)) {
+            std::cerr << languageFile << ": can't be parsed" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::set<std::string> labels;
+        for (const std::pair<std::string, std::string>& entry : entries) {
+            if (getConstantName(entry.first).empty()) {
+                std::cerr << languageFile << ": invalid label \"" << entry.first << '"' << std::endl;
+                return EXIT_FAILURE;
+            }
+            labels.insert(entry.first);
+        }
+
+        if (referenceLabels.empty()) {
+            referenceLabels = labels;
+        } else if (labels != referenceLabels) {
+            for (const std::string& label : referenceLabels) {
+                if (labels.count(label) == 0) {
+                    std::cerr << languageFile << ": missing label \"" << label << '"' << std::endl;
+                }
+            }
+            for (const std::string& label : labels) {
+                if (referenceLabels.count(label) == 0) {
+                    std::cerr << languageFile << ": unknown label \"" << label << '"' << std::endl;
+                }
+            }
+            return EXIT_FAILURE;
+        }
+
+        const std::string name = languageFile.substr(languageFile.find_last_of('/') + 1);
+        const std::string catalogFile = outputDirectory + "/" + name.substr(0, name.find_last_of('.'))
+                + Resources::COMPILED_STRINGS_EXTENSION;
+        std::ofstream catalog(catalogFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        std::string error;
+
+        if (!StringCatalogFormat::write(catalog, entries, error)) {
+            std::cerr << languageFile << ": " << (error.empty() ? "can't write " + catalogFile : error) << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!writeIdsHeader(headerFilename, referenceLabels)) {
+        std::cerr << headerFilename << ": can't be written" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}